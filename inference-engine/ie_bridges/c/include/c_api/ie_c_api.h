@@ -219,7 +219,9 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,    //!< "No resize" mode
     RESIZE_BILINEAR,  //!< "Bilinear resize" mode
-    RESIZE_AREA       //!< "Area resize" mode
+    RESIZE_AREA,      //!< "Area resize" mode
+    RESIZE_BICUBIC,   //!< "Bicubic resize" mode
+    RESIZE_LANCZOS4   //!< "Lanczos resize" mode with 8x8 neighborhood
 } resize_alg_e;
 
 /**
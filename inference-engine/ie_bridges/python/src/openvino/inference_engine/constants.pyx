@@ -66,6 +66,8 @@ class ResizeAlgorithm(Enum):
     NO_RESIZE = 0
     RESIZE_BILINEAR = 1
     RESIZE_AREA = 2
+    RESIZE_BICUBIC = 3
+    RESIZE_LANCZOS4 = 4
 
 
 class ColorFormat(Enum):
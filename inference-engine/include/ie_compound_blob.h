@@ -311,4 +311,34 @@ class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
      */
     explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
 };
+
+/**
+ * @brief This class represents a batch of regions of interest of a single image
+ * @details Unlike BatchedBlob, regions may have different sizes. Such a blob can be set only for
+ * an input with a resize algorithm specified: every region is resized to the network input size
+ * and written to its own item of the input batch during input pre-processing.
+ */
+class INFERENCE_ENGINE_API_CLASS(ROIBatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the ROIBatchedBlob object
+     */
+    using Ptr = std::shared_ptr<ROIBatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const ROIBatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const ROIBatchedBlob>;
+
+    /**
+     * @brief Constructs a batch of regions of an image
+     * @details The image should be a memory blob of NCHW or NHWC layout with batch 1. Regions share
+     * the image memory. Resulting blob's tensor descriptor is the image one with batch dimension
+     * set to rois.size()
+     *
+     * @param image An image blob the regions belong to
+     * @param rois A non-empty vector of regions within the image
+     */
+    ROIBatchedBlob(const Blob::Ptr& image, const std::vector<ROI>& rois);
+};
 }  // namespace InferenceEngine
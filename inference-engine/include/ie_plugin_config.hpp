@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -153,11 +154,26 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric which defines support of import / export functionality by plugin.
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT". Core uses it to decide whether compiled networks can be
+ * stored in and loaded from the directory specified by CONFIG_KEY(CACHE_DIR).
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a size in bytes of memory shared by intermediate tensors of an executable network.
+ *
+ * String value is "PEAK_INTERMEDIATE_MEMORY_SIZE". The value is reported for a single infer stream.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(PEAK_INTERMEDIATE_MEMORY_SIZE, uint64_t);
+
 }  // namespace Metrics
 
 /**
@@ -219,6 +235,47 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief Enables execution of independent graph nodes in parallel on the CPU.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * Mostly useful for latency of models with many independent branches; requires TBB threading.
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_NODE_PARALLELISM);
+
+/**
+ * @brief Enables recording of a CPU execution trace.
+ *
+ * Value is a path to a JSON file in the Chrome trace event format (can be opened with chrome://tracing)
+ * which receives the latest executed graph nodes of all streams when the executable network is destroyed.
+ * The file is created by LoadNetwork, which throws if it cannot be opened.
+ * Empty string (default) switches tracing off.
+ *
+ * Passing the key to ExecutableNetwork::SetConfig writes the trace recorded so far to the given file at once.
+ */
+DECLARE_CONFIG_KEY(CPU_PROFILING_TRACE);
+
+/**
+ * @brief Number of graphs compiled for input shapes other than the loaded network ones the CPU executable
+ * network keeps in its least recently used cache.
+ *
+ * Non-zero value allows to set input blobs of any shape of the same rank: the network is reshaped and compiled
+ * for new shapes on the first inference, output blobs take shapes of the compiled graph. Output blobs set by
+ * a user are never replaced, so inference fails if they do not have shapes of the compiled graph.
+ * 0 (default) disables the cache, so input blobs must have shapes of the loaded network.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_CACHE_SIZE);
+
+/**
+ * @brief Granularity of input shapes cached by CPU_SHAPE_CACHE_SIZE.
+ *
+ * Input dimensions which differ from the loaded network are rounded up to a multiple of the value and input data
+ * is padded with zeros, so the number of compiled graphs is bounded. Outputs have the padded shape then.
+ * 1 (default) compiles a graph for each distinct shape.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_BUCKET);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -372,6 +429,10 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 * The key might enable caching for all plugin or some specific ones, e.g.:
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}) - enables cache for all plugins that might want to use it
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, {"GPU"}) - enables cache only for GPU plugin
+*
+* If a plugin reports METRIC_KEY(IMPORT_EXPORT_SUPPORT), Core stores networks compiled by
+* LoadNetwork in this directory and imports them instead of compiling when the same network
+* is loaded with the same config again. The key can also be passed to LoadNetwork directly.
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
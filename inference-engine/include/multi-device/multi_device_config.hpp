@@ -34,5 +34,22 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling priority of the infer requests, an integer, 0 by default
+ *
+ * Requests waiting for a free device are started from the highest priority ones.
+ * The value is captured by the infer requests created after the key is set with the ExecutableNetwork::SetConfig()
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUEST_PRIORITY);
+
+/**
+ * @brief Deadline of the infer requests in milliseconds since the request is started, 0 (no deadline) by default
+ *
+ * Waiting requests of the same priority are started from the earliest deadline, and a request with a deadline
+ * goes to a device expected to meet it according to the execution times observed so far.
+ * The value is captured by the infer requests created after the key is set with the ExecutableNetwork::SetConfig()
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUEST_DEADLINE);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
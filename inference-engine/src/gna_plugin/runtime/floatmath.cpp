@@ -1,13 +1,122 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software FP32 mode
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "ie_parallel.hpp"
+
+namespace {
+
+// rows of A multiplied by a column of B at once, every row of the block reuses the loaded column
+constexpr uint32_t kRowBlock = 4;
+// independent partial sums of a dot product, lets the compiler vectorize the reduction without fast math
+constexpr uint32_t kLanes = 8;
+// part of the A rows reused from L1 for every column of B
+constexpr uint32_t kDepthBlock = 512;
+// multiply-adds below which splitting the work between threads costs more than it gives
+constexpr size_t kMinParallelWork = 1 << 16;
+
+template <typename F>
+void for_each_block(size_t num_blocks, size_t work, const F& func) {
+    if (work < kMinParallelWork) {
+        for (size_t block = 0; block < num_blocks; block++) {
+            func(block);
+        }
+    } else {
+        InferenceEngine::parallel_for(num_blocks, func);
+    }
+}
+
+// sums[r] = a[r][0:K] . b[0:K]
+template <uint32_t R>
+inline void dot_rows(const float* const* a, const float* b, uint32_t K, float* sums) {
+    float acc[R][kLanes] = {};
+    uint32_t k = 0;
+    for (; k + kLanes <= K; k += kLanes) {
+        for (uint32_t r = 0; r < R; r++) {
+            for (uint32_t l = 0; l < kLanes; l++) {
+                acc[r][l] += a[r][k + l] * b[k + l];
+            }
+        }
+    }
+    for (; k < K; k++) {
+        for (uint32_t r = 0; r < R; r++) {
+            acc[r][0] += a[r][k] * b[k];
+        }
+    }
+    for (uint32_t r = 0; r < R; r++) {
+        float sum = 0.0f;
+        for (uint32_t l = 0; l < kLanes; l++) {
+            sum += acc[r][l];
+        }
+        sums[r] = sum;
+    }
+}
+
+inline void dot_rows(const float* const* a, uint32_t num_rows, const float* b, uint32_t K, float* sums) {
+    if (num_rows == kRowBlock) {
+        dot_rows<kRowBlock>(a, b, K, sums);
+    } else {
+        for (uint32_t r = 0; r < num_rows; r++) {
+            dot_rows<1>(a + r, b, K, sums + r);
+        }
+    }
+}
+
+// C[l * ldc + j] = beta * C[l * ldc + j] + alpha * A[rows[l]][0:K] . Bt[j][0:K], rows[l] is l without the list
+void gemm_nt(uint32_t M, uint32_t N, uint32_t K, float alpha, const float* A, size_t lda,
+             const float* Bt, size_t ldbt, float beta, float* C, size_t ldc, const uint32_t* rows) {
+    const size_t num_blocks = (M + kRowBlock - 1) / kRowBlock;
+    for_each_block(num_blocks, static_cast<size_t>(M) * N * K, [&](size_t block) {
+        const uint32_t l0 = static_cast<uint32_t>(block) * kRowBlock;
+        const uint32_t num_rows = std::min(kRowBlock, M - l0);
+        const float* a[kRowBlock];
+        for (uint32_t r = 0; r < num_rows; r++) {
+            a[r] = A + (rows ? rows[l0 + r] : l0 + r) * lda;
+            float* c = C + (l0 + r) * ldc;
+            for (uint32_t j = 0; j < N; j++) {
+                c[j] = (beta == 0.0f) ? 0.0f : beta * c[j];
+            }
+        }
+        for (uint32_t k0 = 0; k0 < K; k0 += kDepthBlock) {
+            const uint32_t depth = std::min(kDepthBlock, K - k0);
+            const float* a_panel[kRowBlock];
+            for (uint32_t r = 0; r < num_rows; r++) {
+                a_panel[r] = a[r] + k0;
+            }
+            for (uint32_t j = 0; j < N; j++) {
+                float sums[kRowBlock];
+                dot_rows(a_panel, num_rows, Bt + j * ldbt + k0, depth, sums);
+                for (uint32_t r = 0; r < num_rows; r++) {
+                    C[(l0 + r) * ldc + j] += alpha * sums[r];
+                }
+            }
+        }
+    });
+}
+
+// returns the columns of the row major B [K x N] as contiguous rows
+const float* transpose_b(const float* B, size_t ldb, uint32_t K, uint32_t N, std::vector<float>& buffer) {
+    if (N == 1 && ldb == 1) {
+        return B;
+    }
+    buffer.resize(static_cast<size_t>(K) * N);
+    for (uint32_t k = 0; k < K; k++) {
+        for (uint32_t j = 0; j < N; j++) {
+            buffer[j * static_cast<size_t>(K) + k] = B[k * ldb + j];
+        }
+    }
+    return buffer.data();
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,26 +136,11 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        std::vector<float> buffer;
+        const float *Bt = transpose_b(B, ldb, K, N, buffer);
+        gemm_nt(M, N, K, alpha, A, lda, Bt, K, beta, C, ldc, nullptr);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        gemm_nt(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nullptr);
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +199,9 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        std::vector<float> buffer;
+        const float *Bt = transpose_b(B, ldb, K, N, buffer);
+        gemm_nt(L, N, K, alpha, A, lda, Bt, K, beta, C, ldc, OutputList);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,20 +240,24 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
+    const uint32_t num_columns = K1 + K2;
+    const size_t num_blocks = (N + kRowBlock - 1) / kRowBlock;
+
+    for_each_block(num_blocks, static_cast<size_t>(N) * num_columns, [&](size_t block) {
+        const uint32_t i0 = static_cast<uint32_t>(block) * kRowBlock;
+        const uint32_t num_rows = std::min(kRowBlock, N - i0);
+        const float *x1[kRowBlock], *x2[kRowBlock];
+        for (uint32_t r = 0; r < num_rows; r++) {
+            x1[r] = X + static_cast<size_t>(i0 + r) * num_columns;
+            x2[r] = x1[r] + K1;
         }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+        float sums1[kRowBlock], sums2[kRowBlock];
+        dot_rows(x1, num_rows, A1, K1, sums1);
+        dot_rows(x2, num_rows, A2, K2, sums2);
+        for (uint32_t r = 0; r < num_rows; r++) {
+            C[i0 + r] = B[i0 + r] + sums1[r] + sums2[r];
         }
-        C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,321 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <sys/stat.h>
+#ifdef _WIN32
+# include <process.h>
+#else
+# include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/variant.hpp>
+
+#include "details/ie_exception.hpp"
+#include "file_utils.h"
+#include "ie_itt.hpp"
+
+#ifdef _WIN32
+# include <direct.h>
+# ifdef ENABLE_UNICODE_PATH_SUPPORT
+#  define mkdir(dir, mode) _wmkdir(dir)
+# else
+#  define mkdir(dir, mode) _mkdir(dir)
+# endif  // ENABLE_UNICODE_PATH_SUPPORT
+#endif  // _WIN32
+
+namespace InferenceEngine {
+
+namespace {
+
+inline uint64_t mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+inline uint64_t hashCombine(uint64_t seed, uint64_t value) {
+    return seed ^ (mix(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+template <typename T>
+inline uint64_t hashCombine(uint64_t seed, const T& value) {
+    return hashCombine(seed, static_cast<uint64_t>(std::hash<T>()(value)));
+}
+
+uint64_t hashBytes(uint64_t seed, const void* data, size_t size) {
+    const auto bytes = static_cast<const uint8_t*>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        seed = hashCombine(seed, word);
+    }
+    for (; i < size; i++) {
+        seed = hashCombine(seed, static_cast<uint64_t>(bytes[i]));
+    }
+    return hashCombine(seed, static_cast<uint64_t>(size));
+}
+
+/**
+ * @brief Accumulates all visited attributes of a node into a hash
+ *
+ * Attributes which come through the generic void adapter have no accessible value, a network with
+ * such attributes is reported as not hashable.
+ */
+class HashingVisitor : public ngraph::AttributeVisitor {
+    uint64_t& _seed;
+    bool& _hashable;
+
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        _seed = hashCombine(_seed, name);
+        _seed = hashCombine(_seed, value);
+    }
+
+    template <typename T>
+    void hashVector(const std::string& name, const std::vector<T>& values) {
+        _seed = hashCombine(_seed, name);
+        for (const auto& value : values) {
+            _seed = hashCombine(_seed, value);
+        }
+        _seed = hashCombine(_seed, static_cast<uint64_t>(values.size()));
+    }
+
+public:
+    HashingVisitor(uint64_t& seed, bool& hashable) : _seed(seed), _hashable(hashable) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        _hashable = false;
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _seed = hashCombine(_seed, name);
+        _seed = hashBytes(_seed, adapter.get_ptr(), adapter.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+};
+
+uint64_t hashFunction(uint64_t seed, const ngraph::Function& function, bool& hashable) {
+    std::unordered_map<const ngraph::Node*, uint64_t> nodeIds;
+    for (const auto& node : function.get_ordered_ops()) {
+        const auto& typeInfo = node->get_type_info();
+        seed = hashCombine(seed, std::string(typeInfo.name));
+        seed = hashCombine(seed, typeInfo.version);
+        // names generated for unnamed nodes differ each time the same function is built
+        if (node->get_friendly_name() != node->get_name()) {
+            seed = hashCombine(seed, node->get_friendly_name());
+        }
+
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hashCombine(seed, nodeIds.at(source.get_node()));
+            seed = hashCombine(seed, static_cast<uint64_t>(source.get_index()));
+        }
+        for (const auto& output : node->outputs()) {
+            seed = hashCombine(seed, output.get_element_type().get_type_name());
+            std::stringstream shape;
+            shape << output.get_partial_shape();
+            seed = hashCombine(seed, shape.str());
+        }
+        for (const auto& rtInfo : node->get_rt_info()) {
+            seed = hashCombine(seed, rtInfo.first);
+            if (auto stringValue = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtInfo.second)) {
+                seed = hashCombine(seed, stringValue->get());
+            }
+        }
+
+        HashingVisitor visitor(seed, hashable);
+        node->visit_attributes(visitor);
+
+        nodeIds[node.get()] = static_cast<uint64_t>(nodeIds.size());
+    }
+    return seed;
+}
+
+uint64_t hashInputsOutputs(uint64_t seed, const CNNNetwork& network) {
+    for (const auto& input : network.getInputsInfo()) {
+        const auto& info = input.second;
+        seed = hashCombine(seed, input.first);
+        seed = hashCombine(seed, std::string(info->getPrecision().name()));
+        seed = hashCombine(seed, static_cast<uint64_t>(info->getTensorDesc().getLayout()));
+
+        auto& preProcess = info->getPreProcess();
+        seed = hashCombine(seed, static_cast<uint64_t>(preProcess.getResizeAlgorithm()));
+        seed = hashCombine(seed, static_cast<uint64_t>(preProcess.getColorFormat()));
+        seed = hashCombine(seed, static_cast<uint64_t>(preProcess.getMeanVariant()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            const auto& channel = preProcess[c];
+            seed = hashCombine(seed, channel->meanValue);
+            seed = hashCombine(seed, channel->stdScale);
+            if (channel->meanData) {
+                seed = hashBytes(seed, channel->meanData->cbuffer().as<const void*>(), channel->meanData->byteSize());
+            }
+        }
+    }
+    for (const auto& output : network.getOutputsInfo()) {
+        seed = hashCombine(seed, output.first);
+        seed = hashCombine(seed, std::string(output.second->getPrecision().name()));
+        seed = hashCombine(seed, static_cast<uint64_t>(output.second->getLayout()));
+    }
+    return seed;
+}
+
+}  // namespace
+
+std::string ComputeNetworkHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "ComputeNetworkHash");
+    auto function = network.getFunction();
+    if (!function)
+        return {};
+
+    uint64_t seed = 0;
+    bool hashable = true;
+    seed = hashFunction(seed, *function, hashable);
+    if (!hashable)
+        return {};
+    seed = hashInputsOutputs(seed, network);
+    for (const auto& option : compileOptions) {
+        seed = hashCombine(seed, option.first);
+        seed = hashCombine(seed, option.second);
+    }
+
+    std::stringstream hash;
+    hash << std::hex << std::setfill('0') << std::setw(16) << seed;
+    return hash.str();
+}
+
+namespace {
+
+void makeDirectory(const std::string& path) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    std::wstring widepath = FileUtils::multiByteCharToWString(path.c_str());
+    const wchar_t* dir = widepath.c_str();
+#else
+    const char* dir = path.c_str();
+#endif
+
+    auto err = mkdir(dir, 0755);
+    if (err != 0 && errno != EEXIST) {
+        THROW_IE_EXCEPTION << "Couldn't create directory " << path << " (err=" << err << "; errno=" << errno << ")";
+    }
+}
+
+}  // namespace
+
+void CreateDirectory(const std::string& path) {
+#ifdef _WIN32
+    const char* separators = "\\/";
+#else
+    const char* separators = "/";
+#endif
+    // mkdir creates only the last component, so the parents are created first
+    for (auto pos = path.find_first_of(separators, 1); pos != std::string::npos;
+         pos = path.find_first_of(separators, pos + 1)) {
+        auto parent = path.substr(0, pos);
+        if (parent.back() != ':') {
+            makeDirectory(parent);
+        }
+    }
+    makeDirectory(path);
+}
+
+std::string MakeTemporaryPath(const std::string& path) {
+    static std::atomic<uint64_t> counter{0};
+#ifdef _WIN32
+    const auto processId = _getpid();
+#else
+    const auto processId = getpid();
+#endif
+    std::stringstream tmpPath;
+    tmpPath << path << "." << processId << "." << std::hex << std::hash<std::thread::id>()(std::this_thread::get_id())
+            << "." << counter++ << ".tmp";
+    return tmpPath.str();
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Helpers used by Core to cache compiled networks on disk
+ * @file compilation_context.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <cpp/ie_cnn_network.h>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes a hash which identifies a network compiled with the given options
+ *
+ * The hash covers the network topology, operation attributes, constant data, inputs / outputs
+ * information including preprocessing and all compile options (device name, plugin version, config).
+ * A network with an attribute whose value is not accessible through the typed attribute adapters is
+ * not hashed.
+ *
+ * @param network A network with ngraph::Function inside
+ * @param compileOptions Options which affect the compiled network
+ * @return A hexadecimal string or an empty string if the network cannot be hashed
+ */
+std::string ComputeNetworkHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions);
+
+/**
+ * @brief Creates a directory and its parent directories if they do not exist yet
+ * @param path A path to the directory
+ */
+void CreateDirectory(const std::string& path);
+
+/**
+ * @brief Returns a path of a temporary file to write before renaming it to the given path
+ *
+ * The path contains the process id, the thread id and a counter, so it is unique for all writers
+ * sharing the same directory.
+ *
+ * @param path A path of the final file
+ * @return A path of the temporary file
+ */
+std::string MakeTemporaryPath(const std::string& path);
+
+}  // namespace InferenceEngine
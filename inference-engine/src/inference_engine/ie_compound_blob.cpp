@@ -212,6 +212,25 @@ TensorDesc getBlobTensorDesc(const Blob::Ptr& blob) {
     return blob->getTensorDesc();
 }
 
+TensorDesc verifyROIBatchedBlobInput(const Blob::Ptr& image, const std::vector<ROI>& rois) {
+    if (image == nullptr || !image->is<MemoryBlob>()) {
+        THROW_IE_EXCEPTION << "ROIBatchedBlob image must be a MemoryBlob object";
+    }
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "ROIBatchedBlob cannot be created from empty vector of ROI";
+    }
+
+    auto desc = image->getTensorDesc();
+    if (desc.getLayout() != NCHW && desc.getLayout() != NHWC) {
+        THROW_IE_EXCEPTION << "ROIBatchedBlob image layout must be NCHW or NHWC, actual: " << desc.getLayout();
+    }
+    if (desc.getDims()[0] != 1) {
+        THROW_IE_EXCEPTION << "ROIBatchedBlob image must be batch 1";
+    }
+    desc.getDims()[0] = rois.size();
+    return TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout());
+}
+
 TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
     // verify invariants
     if (blobs.empty()) {
@@ -468,4 +487,12 @@ BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs)
     this->_blobs = std::move(blobs);
 }
 
+ROIBatchedBlob::ROIBatchedBlob(const Blob::Ptr& image, const std::vector<ROI>& rois)
+    : CompoundBlob(verifyROIBatchedBlobInput(image, rois)) {
+    this->_blobs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        this->_blobs.push_back(image->createROI(roi));
+    }
+}
+
 }  // namespace InferenceEngine
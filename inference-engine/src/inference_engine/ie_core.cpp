@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <istream>
+#include <fstream>
+#include <cstdio>
 #include <mutex>
 
 #include <ie_core.hpp>
@@ -22,6 +25,7 @@
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "compilation_context.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -271,7 +275,14 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+
+        std::string cacheDir = GetCacheDir(parsed._deviceName, parsed._config);
+        auto pluginConfig = FilterCoreConfig(plugin, parsed._config);
+        if (!cacheDir.empty() && DeviceSupportsImportExport(plugin)) {
+            return LoadNetworkWithCache(plugin, network, parsed._deviceName, pluginConfig, cacheDir);
+        }
+        return plugin.LoadNetwork(network, pluginConfig);
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -325,6 +336,124 @@ public:
         return copyParameterValue(GetCPPPluginByName(parsed._deviceName).GetMetric(name, parsed._config));
     }
 
+    /**
+     * @brief Checks whether a plugin handles CONFIG_KEY(CACHE_DIR) itself
+     * @param plugin A plugin to check
+     * @return `true` if the key is listed in plugin's supported config keys
+     */
+    static bool PluginSupportsCacheDir(const InferencePlugin& plugin) {
+        std::vector<std::string> supportedKeys;
+        try {
+            supportedKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {}).as<std::vector<std::string>>();
+        } catch (...) {
+            return false;
+        }
+        return std::find(supportedKeys.begin(), supportedKeys.end(), CONFIG_KEY(CACHE_DIR)) != supportedKeys.end();
+    }
+
+    /**
+     * @brief Removes CONFIG_KEY(CACHE_DIR) handled by Core from a config if a plugin does not support it
+     * @param plugin A plugin the config is passed to
+     * @param config A config to filter
+     * @return A config which can be passed to the plugin
+     */
+    static std::map<std::string, std::string> FilterCoreConfig(const InferencePlugin& plugin,
+                                                                std::map<std::string, std::string> config) {
+        if (config.count(CONFIG_KEY(CACHE_DIR)) && !PluginSupportsCacheDir(plugin)) {
+            config.erase(CONFIG_KEY(CACHE_DIR));
+        }
+        return config;
+    }
+
+    /**
+     * @brief Checks whether a plugin is able to export and import compiled networks
+     * @param plugin A plugin to check
+     * @return `true` if plugin reports METRIC_KEY(IMPORT_EXPORT_SUPPORT)
+     */
+    static bool DeviceSupportsImportExport(const InferencePlugin& plugin) {
+        try {
+            return plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+        } catch (...) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Returns a cache directory for a device
+     * @param deviceName A name of device
+     * @param config A config passed to LoadNetwork, it has priority over the config set via SetConfig
+     * @return A path to the cache directory or an empty string if caching is disabled
+     */
+    std::string GetCacheDir(const std::string& deviceName, const std::map<std::string, std::string>& config) const {
+        auto it = config.find(CONFIG_KEY(CACHE_DIR));
+        if (it != config.end()) {
+            return it->second;
+        }
+
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        auto desc = pluginRegistry.find(deviceName);
+        if (desc != pluginRegistry.end()) {
+            auto cacheDir = desc->second.defaultConfig.find(CONFIG_KEY(CACHE_DIR));
+            if (cacheDir != desc->second.defaultConfig.end()) {
+                return cacheDir->second;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Imports a network from the cache directory or compiles and exports it there
+     * @param plugin A plugin to load the network to
+     * @param network A network to load
+     * @param deviceName A name of device
+     * @param config A config for the plugin
+     * @param cacheDir A path to the cache directory
+     * @return An executable network
+     */
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const CNNNetwork& network, const std::string& deviceName,
+                                           const std::map<std::string, std::string>& config, const std::string& cacheDir) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::LoadNetworkWithCache");
+        auto compileOptions = config;
+        compileOptions["DEVICE_NAME"] = deviceName;
+        compileOptions["BUILD_NUMBER"] = plugin.GetVersion().buildNumber;
+        compileOptions.erase(CONFIG_KEY(CACHE_DIR));
+
+        auto hash = ComputeNetworkHash(network, compileOptions);
+        if (hash.empty()) {
+            return plugin.LoadNetwork(network, config);
+        }
+
+        auto blobPath = FileUtils::makePath(cacheDir, hash + ".blob");
+        if (FileUtils::fileExist(blobPath)) {
+            try {
+                std::ifstream networkStream(blobPath, std::ios::binary);
+                return plugin.ImportNetwork(networkStream, config);
+            } catch (const details::InferenceEngineException&) {
+                // the cached blob is outdated or broken, recompile and overwrite it
+            }
+        }
+
+        auto execNetwork = plugin.LoadNetwork(network, config);
+
+        // export to a temporary file first so parallel loads never see a partially written blob
+        auto tmpPath = MakeTemporaryPath(blobPath);
+        try {
+            CreateDirectory(cacheDir);
+            {
+                std::ofstream networkStream(tmpPath, std::ios::binary);
+                execNetwork.Export(networkStream);
+            }
+            std::remove(blobPath.c_str());
+            if (std::rename(tmpPath.c_str(), blobPath.c_str()) != 0) {
+                std::remove(tmpPath.c_str());
+            }
+        } catch (...) {
+            // failure to populate the cache must not break LoadNetwork
+            std::remove(tmpPath.c_str());
+        }
+        return execNetwork;
+    }
+
     /**
      * @deprecated
      * @brief Returns reference to CPP plugin wrapper by a device name
@@ -367,7 +496,7 @@ public:
                 // configuring
                 {
                     allowNotImplemented([&]() {
-                        plugin.SetConfig(desc.defaultConfig);
+                        plugin.SetConfig(FilterCoreConfig(plugin, desc.defaultConfig));
                     });
 
                     allowNotImplemented([&]() {
@@ -474,7 +603,7 @@ public:
         for (auto& plugin : plugins) {
             if (deviceName.empty() || deviceName == plugin.first) {
                 allowNotImplemented([&]() {
-                    plugin.second.SetConfig(config);
+                    plugin.second.SetConfig(FilterCoreConfig(plugin.second, config));
                 });
             }
         }
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -205,21 +206,37 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
+                Blob::Ptr weights;
+                // Map weights file into memory to share its pages between processes
+                auto mmapAllocator = details::shared_from_irelease(details::CreateMmapAllocator(weights_path));
+                if (mmapAllocator) {
+                    const auto fileSize = FileUtils::fileSize(bPath);
+                    if (fileSize > 0) {
+                        weights = make_shared_blob<uint8_t>({Precision::U8, { static_cast<size_t>(fileSize) }, C }, mmapAllocator);
+                        weights->allocate();
+                        if (weights->cbuffer() == nullptr)
+                            weights = nullptr;
+                    }
+                }
 
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
+                // Fallback to reading of the whole weights file
+                if (!weights) {
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
 
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
 
-                binStream.read(weights->buffer(), fileSize);
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                    weights->allocate();
 
-                binStream.close();
+                    binStream.read(weights->buffer(), fileSize);
+
+                    binStream.close();
+                }
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief An allocator which maps a file into memory instead of allocating heap memory
+ * @file mmap_allocator.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Creates an allocator which maps the beginning of a file into memory.
+ *
+ * The mapping is private and copy-on-write: pages stay shared with the OS page cache (and with all other
+ * processes mapping the same file) until somebody writes into them. `alloc(size)` fails and returns `nullptr`
+ * if the file cannot be opened, cannot be mapped or is smaller than the requested size, so callers are expected
+ * to fall back to a regular allocation.
+ *
+ * @param path A path to the file to map
+ * @return The IAllocator* instance or `nullptr` in case of failure
+ */
+IAllocator* CreateMmapAllocator(const std::string& path) noexcept;
+
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+/**
+ * @brief Creates an allocator which maps the beginning of a file into memory.
+ * @param path A unicode path to the file to map
+ * @return The IAllocator* instance or `nullptr` in case of failure
+ */
+IAllocator* CreateMmapAllocator(const std::wstring& path) noexcept;
+#endif
+
+}  // namespace details
+}  // namespace InferenceEngine
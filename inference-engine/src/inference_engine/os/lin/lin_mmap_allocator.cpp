@@ -0,0 +1,75 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "mmap_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+class MmapAllocator : public IAllocator {
+    std::string _path;
+    size_t _size = 0;
+
+public:
+    explicit MmapAllocator(const std::string& path) : _path(path) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (size == 0)
+            return nullptr;
+
+        int fd = open(_path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return nullptr;
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1 || static_cast<size_t>(sb.st_size) < size) {
+            close(fd);
+            return nullptr;
+        }
+
+        // MAP_PRIVATE with write access keeps the pages shared until they are modified
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // the mapping holds its own reference to the file
+        close(fd);
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        _size = size;
+        return data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr)
+            return true;
+        return munmap(handle, _size) == 0;
+    }
+};
+
+IAllocator* CreateMmapAllocator(const std::string& path) noexcept {
+    try {
+        return new MmapAllocator(path);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
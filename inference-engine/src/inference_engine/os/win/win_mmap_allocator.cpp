@@ -0,0 +1,103 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+#include <string>
+
+#include "mmap_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+HANDLE OpenFileForMapping(const std::string& path) {
+    return CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+}
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+HANDLE OpenFileForMapping(const std::wstring& path) {
+    return CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+}
+#endif
+
+}  // namespace
+
+template <typename PathType>
+class MmapAllocator : public IAllocator {
+    PathType _path;
+
+public:
+    explicit MmapAllocator(const PathType& path) : _path(path) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (size == 0)
+            return nullptr;
+
+        HANDLE file = OpenFileForMapping(_path);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < size) {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        // PAGE_WRITECOPY keeps the pages shared until they are modified
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+            return nullptr;
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+        // the view holds its own reference to the mapping object
+        CloseHandle(mapping);
+        return data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr)
+            return true;
+        return UnmapViewOfFile(handle) != 0;
+    }
+};
+
+IAllocator* CreateMmapAllocator(const std::string& path) noexcept {
+    try {
+        return new MmapAllocator<std::string>(path);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+IAllocator* CreateMmapAllocator(const std::wstring& path) noexcept {
+    try {
+        return new MmapAllocator<std::wstring>(path);
+    } catch (...) {
+        return nullptr;
+    }
+}
+#endif
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 #include <queue>
 #include <atomic>
 #include <climits>
+#include <cstdint>
 #include <cassert>
 #include <utility>
 
@@ -25,6 +26,81 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue (D. Vyukov's algorithm).
+ * Each cell has a sequence number which tells producers and consumers whether the cell is free or filled
+ * for the current lap, so positions are claimed with a single CAS and no lock is ever taken.
+ */
+template <typename T>
+class MPMCBoundedQueue {
+public:
+    explicit MPMCBoundedQueue(std::size_t capacity) :
+        _cells(new Cell[capacity]),
+        _mask(capacity - 1) {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto seq = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto seq = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t CacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+    std::unique_ptr<Cell[]>     _cells;
+    const std::size_t           _mask;
+    char                        _pad0[CacheLineSize];
+    std::atomic<std::size_t>    _enqueuePos = {0};
+    char                        _pad1[CacheLineSize - sizeof(std::atomic<std::size_t>)];
+    std::atomic<std::size_t>    _dequeuePos = {0};
+    char                        _pad2[CacheLineSize - sizeof(std::atomic<std::size_t>)];
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -159,18 +235,34 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new MPMCBoundedQueue<Task>{TaskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
+                    if (!PopTask(streamId, task)) {
+                        // Spin for a while: under load the next task usually arrives before
+                        // a parked thread would be woken up
+                        for (int spin = 0; spin < SpinCount && !PopTask(streamId, task); ++spin) {
+                            std::this_thread::yield();
+                        }
+                    }
+                    if (!task) {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        _sleepingThreads.fetch_add(1);
+                        // re-check queues after announcing the sleep, so a task pushed meanwhile is not missed
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (!PopTask(streamId, task)) {
+                            if (_isStopped) {
+                                _sleepingThreads.fetch_sub(1);
+                                break;
+                            }
+                            _queueCondVar.wait(lock);
                         }
+                        _sleepingThreads.fetch_sub(1);
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
@@ -180,12 +272,51 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    /**
+     * Tasks are spread over per stream lock-free queues. A stream takes tasks from its own queue first
+     * and steals from other streams if it is empty.
+     */
+    bool PopTask(int streamId, Task& task) {
+        auto numQueues = _taskQueues.size();
+        for (std::size_t i = 0; i < numQueues; ++i) {
+            if (_taskQueues[(streamId + i) % numQueues]->TryPop(task)) return true;
+        }
+        if (_overflowSize.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_overflowQueue.empty()) {
+                task = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                _overflowSize.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * If all queues are full tasks go to the overflow queue, which is not expected in practice. Streams take tasks
+     * from there only when queues are empty, so while it is not drained all new tasks are put after it
+     * to keep the order they were submitted in.
+     */
     void Enqueue(Task task) {
-        {
+        auto numQueues = _taskQueues.size();
+        bool pushed = false;
+        if (_overflowSize.load(std::memory_order_acquire) == 0) {
+            auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t i = 0; i < numQueues && !pushed; ++i) {
+                pushed = _taskQueues[(first + i) % numQueues]->TryPush(task);
+            }
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepingThreads.load(std::memory_order_relaxed) != 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -221,9 +352,16 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    static constexpr std::size_t            TaskQueueCapacity = 1024;
+    static constexpr int                    SpinCount = 128;
+    std::vector<std::unique_ptr<MPMCBoundedQueue<Task>>>   _taskQueues;
+    std::atomic<std::size_t>                _nextQueue = {0};
+    std::mutex                              _overflowMutex;
+    std::queue<Task>                        _overflowQueue;
+    std::atomic<std::size_t>                _overflowSize = {0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::atomic<int>                        _sleepingThreads = {0};
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
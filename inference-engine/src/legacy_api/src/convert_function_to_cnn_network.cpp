@@ -11,6 +11,8 @@
 #include <cnn_network_ngraph_impl.hpp>
 #include "ngraph_ops/convolution_ie.hpp"
 #include "ngraph_ops/deconvolution_ie.hpp"
+#include "ngraph_ops/layer_norm.hpp"
+#include "ngraph_ops/scaled_dot_product_attention.hpp"
 #include "legacy/ngraph_ops/eltwise.hpp"
 #include "legacy/ngraph_ops/fully_connected.hpp"
 #include "legacy/ngraph_ops/gather_ie.hpp"
@@ -896,6 +898,31 @@ InferenceEngine::details::CNNLayerCreator::CNNLayerCreator(const std::shared_ptr
         return res;
     });
 
+    addSpecificCreator({"LayerNorm"}, [](const std::shared_ptr<::ngraph::Node>& node,
+                                         const std::map<std::string, std::string>& params) -> CNNLayerPtr {
+        LayerParams attrs = {node->get_friendly_name(), "LayerNorm", details::convertPrecision(node->get_output_element_type(0))};
+        auto res = std::make_shared<InferenceEngine::CNNLayer>(attrs);
+        res->params = params;
+        // std::to_string loses small epsilons like 1e-12
+        auto layer_norm = std::dynamic_pointer_cast<::ngraph::op::LayerNorm>(node);
+        if (layer_norm)
+            res->params["eps"] = Builder::asString(layer_norm->get_eps());
+        return res;
+    });
+
+    addSpecificCreator({"ScaledDotProductAttention"}, [](const std::shared_ptr<::ngraph::Node>& node,
+                                                         const std::map<std::string, std::string>& params) -> CNNLayerPtr {
+        LayerParams attrs = {node->get_friendly_name(), "ScaledDotProductAttention",
+                             details::convertPrecision(node->get_output_element_type(0))};
+        auto res = std::make_shared<InferenceEngine::CNNLayer>(attrs);
+        res->params = params;
+        // std::to_string keeps 6 decimals only, not enough for scales like 1/sqrt(96)
+        auto attention = std::dynamic_pointer_cast<::ngraph::op::ScaledDotProductAttention>(node);
+        if (attention)
+            res->params["scale"] = Builder::asString(attention->get_scale());
+        return res;
+    });
+
     addSpecificCreator({"OneHotIE"}, [](const std::shared_ptr<::ngraph::Node>& node,
                                       const std::map<std::string, std::string>& params) -> CNNLayerPtr {
         LayerParams attrs = {node->get_friendly_name(), "OneHot", details::convertPrecision(node->get_output_element_type(0))};
@@ -77,9 +77,38 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_NODE_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interNodeParallelism = true;
+            else if (val == PluginConfigParams::NO) interNodeParallelism = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_NODE_PARALLELISM
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
+        } else if (key == PluginConfigParams::KEY_CPU_PROFILING_TRACE) {
+            // empty string means that tracing is switched off
+            profilingTrace = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            shapeCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_BUCKET) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_BUCKET
+                                   << ". Expected only positive integer numbers";
+            shapeBucket = val_i;
         } else if (key.compare(PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE) == 0) {
             if (val == PluginConfigParams::NO)
                 lpTransformsMode = LPTransformsMode::Off;
@@ -139,10 +168,18 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (interNodeParallelism == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_NODE_PARALLELISM, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_NODE_PARALLELISM, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_CPU_PROFILING_TRACE, profilingTrace });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, std::to_string(shapeCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_BUCKET, std::to_string(shapeBucket) });
         if (!with_cpu_x86_bfloat16())
             enforceBF16 = false;
         if (enforceBF16)
@@ -6,9 +6,48 @@
 #include "ie_parallel.hpp"
 #include "nodes/common/cpu_memcpy.h"
 
+#include <algorithm>
+
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+/**
+ * Writes (src - mean) * scale for an N x C x H x W input. Output channels are grouped by dstBlock:
+ * 1 means planar NCHW, C means NHWC, 8 or 16 means nChw8c / nChw16c with channel tail filled by zeros.
+ */
+template <typename T>
+void normalize(const T *src, bool srcNHWC, float *dst, size_t dstBlock, size_t N, size_t C, size_t H, size_t W,
+               const float *meanImage, const std::vector<float> &meanValues, const std::vector<float> &scaleValues) {
+    const size_t CB = (C + dstBlock - 1) / dstBlock;
+    const size_t srcChannelStride = srcNHWC ? 1 : H * W;
+    const size_t srcPixelStride = srcNHWC ? C : 1;
+
+    parallel_for3d(N, CB, H, [&](size_t n, size_t cb, size_t h) {
+        float *dstRow = dst + ((n * CB + cb) * H + h) * W * dstBlock;
+        const size_t channels = (std::min)(dstBlock, C - cb * dstBlock);
+        for (size_t w = 0; w < W; w++) {
+            const size_t pixel = n * C * H * W + (h * W + w) * srcPixelStride;
+            for (size_t cin = 0; cin < channels; cin++) {
+                const size_t c = cb * dstBlock + cin;
+                float value = static_cast<float>(src[pixel + c * srcChannelStride]);
+                if (meanImage)
+                    value -= meanImage[(c * H + h) * W + w];
+                else if (!meanValues.empty())
+                    value -= meanValues[c];
+                if (!scaleValues.empty())
+                    value *= scaleValues[c];
+                dstRow[w * dstBlock + cin] = value;
+            }
+            for (size_t cin = channels; cin < dstBlock; cin++)
+                dstRow[w * dstBlock + cin] = 0.0f;
+        }
+    });
+}
+
+}  // namespace
+
 MeanImage::MeanImage() : meanBuffer(nullptr) {
 }
 
@@ -24,6 +63,14 @@ void MeanImage::Load(const MKLDNNDims& inputDims, InputInfo::Ptr inputInfo) {
         THROW_IE_EXCEPTION << "channels mismatch between mean and input";
     }
 
+    scaleValues.resize(inChannels);
+    for (unsigned channel = 0; channel < inChannels; channel++) {
+        scaleValues[channel] = pp[channel]->stdScale;
+    }
+    if (std::all_of(scaleValues.begin(), scaleValues.end(), [](float scale) { return scale == 1.0f; })) {
+        scaleValues.clear();
+    }
+
     switch (pp.getMeanVariant()) {
         case MEAN_VALUE: {
             // mean image common value per channel (1x1xC)
@@ -106,4 +153,84 @@ void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input, InferenceEng
             });
         }
     }
+
+    if (!scaleValues.empty()) {
+        int C = inputDims[1];
+        int spatialSize = inputDims.size() / MB / C;
+
+        if (layout == NCHW) {
+            parallel_for3d(MB, C, spatialSize, [&](int mb, int c, int i) {
+                input[mb * C * spatialSize + c * spatialSize + i] *= scaleValues[c];
+            });
+        } else if (layout == NHWC) {
+            parallel_for2d(MB, spatialSize, [&](int mb, int i) {
+                for (int c = 0; c < C; c++)
+                    input[mb * spatialSize * C + i * C + c] *= scaleValues[c];
+            });
+        }
+    }
+}
+
+bool MeanImage::CanNormalize(const Blob::Ptr &input, const MKLDNNMemory &output) const {
+    const auto &desc = input->getTensorDesc();
+    const auto &dims = desc.getDims();
+    if (dims.size() != 4 || (desc.getLayout() != NCHW && desc.getLayout() != NHWC) ||
+        (desc.getPrecision() != Precision::U8 && desc.getPrecision() != Precision::FP32))
+        return false;
+
+    // ROI and padded blobs are not dense
+    const auto &blocking = desc.getBlockingDesc();
+    if (blocking.getOffsetPadding() != 0)
+        return false;
+    size_t denseStride = 1;
+    for (size_t i = blocking.getBlockDims().size(); i-- > 0;) {
+        if (blocking.getStrides()[i] != denseStride)
+            return false;
+        denseStride *= blocking.getBlockDims()[i];
+    }
+
+    const auto outputDims = output.GetDims();
+    if (output.GetDataType() != mkldnn::memory::f32 || outputDims != std::vector<ptrdiff_t>(dims.begin(), dims.end()))
+        return false;
+
+    switch (output.GetFormat()) {
+        case mkldnn::memory::nchw:
+        case mkldnn::memory::nhwc:
+        case mkldnn::memory::nChw8c:
+        case mkldnn::memory::nChw16c:
+            break;
+        default:
+            return false;
+    }
+
+    return !meanBuffer || !meanBuffer->size() || meanBuffer->size() == dims[1] * dims[2] * dims[3];
+}
+
+bool MeanImage::Normalize(const Blob::Ptr &input, const MKLDNNMemory &output) const {
+    if (!CanNormalize(input, output))
+        return false;
+
+    const auto &desc = input->getTensorDesc();
+    const auto &dims = desc.getDims();
+    const size_t N = dims[0], C = dims[1], H = dims[2], W = dims[3];
+    size_t block;
+    switch (output.GetFormat()) {
+        case mkldnn::memory::nchw: block = 1; break;
+        case mkldnn::memory::nhwc: block = C; break;
+        case mkldnn::memory::nChw8c: block = 8; break;
+        default: block = 16; break;
+    }
+
+    const float *meanImage = meanBuffer && meanBuffer->size() ? meanBuffer->readOnly() : nullptr;
+
+    auto dst = static_cast<float *>(output.GetData()) + output.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const bool srcNHWC = desc.getLayout() == NHWC;
+    if (desc.getPrecision() == Precision::U8) {
+        normalize(input->cbuffer().as<const uint8_t *>(), srcNHWC, dst, block, N, C, H, W,
+                  meanImage, meanValues, scaleValues);
+    } else {
+        normalize(input->cbuffer().as<const float *>(), srcNHWC, dst, block, N, C, H, W,
+                  meanImage, meanValues, scaleValues);
+    }
+    return true;
 }
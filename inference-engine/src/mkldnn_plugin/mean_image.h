@@ -7,6 +7,7 @@
 #include "ie_input_info.hpp"
 
 #include "mkldnn_dims.h"
+#include "mkldnn_memory.h"
 #include "ie_parallel.hpp"
 #include <vector>
 #include <limits>
@@ -21,6 +22,19 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void Subtract(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * @brief Checks if Normalize supports the input: a dense U8 or FP32 NCHW/NHWC blob of the output dims
+     * and FP32 output memory in nchw, nhwc, nChw8c or nChw16c format
+     */
+    bool CanNormalize(const InferenceEngine::Blob::Ptr &input, const MKLDNNMemory &output) const;
+
+    /**
+     * @brief Converts the input to FP32, subtracts the mean, applies the scale and stores the result
+     * in the layout of the output memory in a single pass
+     * @return false if CanNormalize rejects the input, nothing is written then
+     */
+    bool Normalize(const InferenceEngine::Blob::Ptr &input, const MKLDNNMemory &output) const;
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void Subtract(const MKLDNNDims &inputDims, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
@@ -34,46 +48,42 @@ public:
         }
 
         int MB = inputDims[0];
-        int srcSize = inputDims.size() / MB;
-
-        if (meanBuffer && meanBuffer->size()) {
-            const float * meanBufferValues = meanBuffer->readOnly();
-
-            InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                int buf = input[srcSize * mb + i];
-                buf -= meanBufferValues[i];
-                if (buf < (std::numeric_limits<T>::min)()) buf = (std::numeric_limits<T>::min)();
-                if (buf > (std::numeric_limits<T>::max)()) buf = (std::numeric_limits<T>::max)();
-                input[srcSize * mb + i] = buf;
+        int C = inputDims[1];
+        int spatialSize = inputDims.size() / MB / C;
+        const float *meanBufferValues = meanBuffer && meanBuffer->size() ? meanBuffer->readOnly() : nullptr;
+        if (!meanBufferValues && meanValues.empty() && scaleValues.empty())
+            return;
+
+        // the same (x - mean) * scale as for FP32 inputs, saturated to the input type
+        auto normalize = [&](T &value, int c, int meanIndex) {
+            float buf = value;
+            if (meanBufferValues)
+                buf -= meanBufferValues[meanIndex];
+            else if (!meanValues.empty())
+                buf -= meanValues[c];
+            if (!scaleValues.empty())
+                buf *= scaleValues[c];
+            if (buf < (std::numeric_limits<T>::min)()) buf = (std::numeric_limits<T>::min)();
+            if (buf > (std::numeric_limits<T>::max)()) buf = (std::numeric_limits<T>::max)();
+            value = static_cast<T>(buf);
+        };
+
+        if (layout == InferenceEngine::NCHW) {
+            InferenceEngine::parallel_for3d(MB, C, spatialSize, [&](int mb, int c, int i) {
+                normalize(input[(mb * C + c) * spatialSize + i], c, c * spatialSize + i);
+            });
+        } else {
+            InferenceEngine::parallel_for2d(MB, spatialSize, [&](int mb, int i) {
+                for (int c = 0; c < C; c++)
+                    normalize(input[(mb * spatialSize + i) * C + c], c, i * C + c);
             });
-        } else if (!meanValues.empty()) {
-            int C = inputDims[1];
-            srcSize /= inputDims[1];
-
-            if (layout == InferenceEngine::NCHW) {
-                InferenceEngine::parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                    int buf = input[srcSize * mb * C + c * srcSize + i];
-                    buf -= meanValues[c];
-                    if (buf < (std::numeric_limits<T>::min)()) buf = (std::numeric_limits<T>::min)();
-                    if (buf > (std::numeric_limits<T>::max)()) buf = (std::numeric_limits<T>::max)();
-                    input[srcSize * mb * C + c * srcSize + i] = buf;
-                });
-            } else if (layout == InferenceEngine::NHWC) {
-                InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                    for (int c = 0; c < C; c++) {
-                        int buf = input[mb * srcSize * C + i * C + c];
-                        buf -= meanValues[c];
-                        if (buf < (std::numeric_limits<T>::min)()) buf = (std::numeric_limits<T>::min)();
-                        if (buf > (std::numeric_limits<T>::max)()) buf = (std::numeric_limits<T>::max)();
-                        input[mb * srcSize * C + i * C + c] = buf;
-                    }
-                });
-            }
         }
     }
 
 private:
     std::vector<float> meanValues;
+    // empty if all channel scales are 1
+    std::vector<float> scaleValues;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpp_interfaces/exception2status.hpp>
 #include <precision_utils.h>
 #include <legacy/net_pass.h>
 #include "mkldnn_exec_network.h"
@@ -11,7 +12,9 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_generic_node.h"
 #include "bf16transformer.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
@@ -24,6 +27,7 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <fstream>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 using namespace MKLDNNPlugin;
@@ -40,21 +44,91 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
                                      NumaNodesWeights &numaNodesWeights) :
+    MKLDNNExecNetwork(cloneNet(network), cfg, extMgr, numaNodesWeights) {
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights) :
+    MKLDNNExecNetwork(network, cfg, extMgr, numaNodesWeights, nullptr) {
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const std::shared_ptr<const CompiledGraphInfo> &compiledInfo) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _clonedNetwork(network),
     _cfg{cfg},
-    _name{network.getName()} {
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+    _name{network->getName()},
+    _numaNodesWeights(numaNodesWeights) {
+    // an imported network was prepared before it was exported
+    if (!compiledInfo) {
+        prepareNetwork(_clonedNetwork);
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+    }
+    if (0 != cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+
+    if (!_cfg.profilingTrace.empty()) {
+        // the file is opened in advance, so the trace is not lost when the network is destroyed
+        _perfTraceFile.open(_cfg.profilingTrace);
+        if (!_perfTraceFile.is_open())
+            THROW_IE_EXCEPTION << "Cannot open profiling trace file " << _cfg.profilingTrace;
+        _perfTrace.reset(new PerfTrace());
+    }
+
+    _graphs = decltype(_graphs){[this, compiledInfo] {
+        return createGraph(*_clonedNetwork, compiledInfo);
+    }};
+
+    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    if (_graphs.size() == 1) {
+        for (auto &node : _graphs.begin()->get()->GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                auto state_store = memoryNode->getStore();
+                auto state_name = memoryNode->getId();
+
+                // Remove suffix with pair ID. Internal information.
+                auto suffix_idx = state_name.find("/id=");
+                if (suffix_idx != std::string::npos)
+                    state_name = state_name.substr(0, suffix_idx);
+
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            }
+        }
+    }
+}
 
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+void MKLDNNExecNetwork::prepareNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network) {
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::prepareNetwork", "transformNetwork");
 
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
         // BF16 + INT8 or BF16 + BIN.
         bool isFloatModel = true;
-        CNNNetworkIterator i(&network);
+        CNNNetworkIterator i(network.get());
         while (i != CNNNetworkIterator()) {
             if (CaselessEq<std::string>()((*i)->type, "FakeQuantize")) {
                 isFloatModel = false;
@@ -65,15 +139,15 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
         if (with_cpu_x86_bfloat16() && isFloatModel) {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(network);
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
+            if (_cfg.enforceBF16 == true)
                 bf16Transformer.convertToBFloat16(cnnetwork);
         } else {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(network);
             bf16Transformer.convertToFloat(cnnetwork);
         }
     }
@@ -96,9 +170,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         getCreatorLayer(newEdgeAfterLayer) = constLayer;
         getInputTo(newEdgeAfterLayer).clear();
 
-        _clonedNetwork->addData(constLayer->name.c_str(), newEdgeAfterLayer);
+        network->addData(constLayer->name.c_str(), newEdgeAfterLayer);
         IE_SUPPRESS_DEPRECATED_START
-        _clonedNetwork->addLayer(constLayer);
+        network->addLayer(constLayer);
         IE_SUPPRESS_DEPRECATED_END
 
         constLayer->outData.push_back(newEdgeAfterLayer);
@@ -106,7 +180,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         layer->insData.push_back(newEdgeAfterLayer);
     };
 
-    auto all_layers = details::CNNNetSortTopologically(*_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(*network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             Blob::Ptr scalesBlob = layer->blobs["weights"];
@@ -138,88 +212,164 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
-        if (!CanProcessDynBatch(*_clonedNetwork)) {
+        if (!CanProcessDynBatch(*network)) {
             THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
         }
     }
+}
 
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+MKLDNNGraph::Ptr MKLDNNExecNetwork::createGraph(const InferenceEngine::details::CNNNetworkImpl &network,
+                                                const std::shared_ptr<const CompiledGraphInfo> &compiledInfo) {
+    // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+    //       is fixed and does not change content of network passed (CVS-26420)
+    auto localNetwork = cloneNet(static_cast<const ICNNNetwork&>(network));
+
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
+    // graph is created and executed by a stream thread only, one inference at a time
+    graph->ShareWorkspaceWithThreadGraphs(true);
+    int numaNode = 0;
+    int streamId = 0;
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamExecutor) {
+        numaNode = streamExecutor->GetNumaNodeId();
+        streamId = streamExecutor->GetStreamId();
     }
+    graph->SetPerfTrace(_perfTrace.get(), streamId);
+    graph->SetCompiledInfo(compiledInfo);
+
+    graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, _numaNodesWeights[numaNode]);
+
+    // graphs are created on demand by stream threads, so setProperty doesn't walk the thread local storages
+    // but the list of created graphs, the config is taken again in case it was changed during the compilation
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    graph->setConfig(_cfg);
+    _createdGraphs.erase(std::remove_if(_createdGraphs.begin(), _createdGraphs.end(),
+                                        [](const std::weak_ptr<MKLDNNGraph>& created) { return created.expired(); }),
+                         _createdGraphs.end());
+    _createdGraphs.emplace_back(graph);
+    return graph;
+}
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    if (_perfTrace) {
+        _perfTrace->dump(_perfTraceFile);
+    }
+}
 
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
-        }
+void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    _cfg.readProperties(properties);
+    for (auto& created : _createdGraphs) {
+        if (auto graph = created.lock())
+            graph->setProperty(properties);
+    }
+}
 
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
-        return graph;
-    }};
+InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
+    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+}
 
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
+    if (_graphs.size() == 0)
+        THROW_IE_EXCEPTION << "No graph was found";
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : _graphs.begin()->get()->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
+    return _graphs.begin()->get()->dump();
+}
 
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+void MKLDNNExecNetwork::setLoadConfig(const std::map<std::string, std::string> &config) {
+    _loadConfig = config;
+}
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
-        }
+void MKLDNNExecNetwork::setNetworkConverter(const InferenceEngine::ICNNNetwork::Ptr &network,
+                                            const NetworkConverter &converter) {
+    if (!memoryStates.empty()) {
+        THROW_IE_EXCEPTION << "Shape cache is not supported for networks with memory states";
     }
+    _reshapableNetwork = network;
+    _networkConverter = converter;
 }
 
-void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraph(const ICNNNetwork::InputShapes &shapes) {
+    if (!_networkConverter) {
+        THROW_IE_EXCEPTION << "Network was loaded without shape cache and cannot be compiled for other input shapes";
+    }
+    auto findShapes = [&] {
+        auto found = std::find_if(_shapeCache.begin(), _shapeCache.end(), [&](const ShapeCache::value_type& cached) {
+            return cached.first == shapes;
+        });
+        if (found != _shapeCache.end()) {
+            _shapeCache.splice(_shapeCache.begin(), _shapeCache, found);
+            return _shapeCache.front().second;
+        }
+        return std::shared_ptr<ShapeVariant>{};
+    };
+
+    std::shared_ptr<ShapeVariant> variant;
     {
-        std::lock_guard<std::mutex> lock{_cfgMutex};
-        _cfg.readProperties(properties);
+        std::lock_guard<std::mutex> lock{_shapeCacheMutex};
+        variant = findShapes();
     }
-    for (auto g : _graphs) {
-        g->setProperty(properties);
+    if (!variant) {
+        // the conversion is much longer than an inference, so requests of other streams are not blocked meanwhile
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::GetGraph");
+        auto network = _networkConverter(*_reshapableNetwork, shapes);
+        prepareNetwork(network);
+        auto converted = std::make_shared<ShapeVariant>(network, [this, network] {
+            return createGraph(*network);
+        });
+
+        std::lock_guard<std::mutex> lock{_shapeCacheMutex};
+        // the same shapes may have been converted by another stream in between
+        variant = findShapes();
+        if (!variant) {
+            variant = converted;
+            _shapeCache.emplace_front(shapes, variant);
+            if (_shapeCache.size() > static_cast<size_t>(_cfg.shapeCacheSize)) {
+                // requests which still run the evicted graphs keep them alive
+                _shapeCache.pop_back();
+            }
+        }
     }
+    return variant->graphs.local();
 }
 
-InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
-}
-
-InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
+    auto graph = _graphs.begin()->get();
+    for (auto &node : graph->GetNodes()) {
+        // implementations of ngraph operations are created from the ngraph::Function the network is not exported with
+        auto genericNode = dynamic_cast<MKLDNNGenericNode*>(node.get());
+        if (genericNode != nullptr && genericNode->isOperationImplementation()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks with extension operation "
+                               << node->getName() << " is not supported";
+        }
+    }
+    SerializeNetwork(networkModel, *_clonedNetwork, graph->GetCompiledInfo(), _reshapableNetwork,
+                     _networkInputs, _networkOutputs, _loadConfig);
+}
 
-    return _graphs.begin()->get()->dump();
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    auto trace = config.find(PluginConfigParams::KEY_CPU_PROFILING_TRACE);
+    if (config.size() != 1 || trace == config.end()) {
+        ExecutableNetworkThreadSafeDefault::SetConfig(config);
+        return;
+    }
+    if (!_perfTrace)
+        THROW_IE_EXCEPTION << "Network was loaded without " << PluginConfigParams::KEY_CPU_PROFILING_TRACE;
+
+    const auto path = trace->second.as<std::string>();
+    std::ofstream traceFile(path);
+    if (!traceFile.is_open())
+        THROW_IE_EXCEPTION << "Cannot open profiling trace file " << path;
+    _perfTrace->dump(traceFile);
+    if (!traceFile)
+        THROW_IE_EXCEPTION << "Cannot write profiling trace file " << path;
 }
 
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
@@ -246,6 +396,7 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(EXEC_NETWORK_METRIC_KEY(PEAK_INTERMEDIATE_MEMORY_SIZE));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -260,6 +411,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == EXEC_NETWORK_METRIC_KEY(PEAK_INTERMEDIATE_MEMORY_SIZE)) {
+        IE_SET_METRIC_RETURN(PEAK_INTERMEDIATE_MEMORY_SIZE,
+            static_cast<uint64_t>(_graphs.begin()->get()->GetWorkspaceSize()));
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
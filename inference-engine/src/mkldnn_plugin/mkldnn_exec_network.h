@@ -10,10 +10,14 @@
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <fstream>
+#include <functional>
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
+#include <utility>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -32,16 +36,61 @@ public:
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
 
-    ~MKLDNNExecNetwork() override = default;
+    /**
+     * @brief Takes ownership of a network which is not referenced by anyone else (e.g. converted from ngraph
+     * during LoadNetwork), so it is modified in place instead of being cloned once more
+     */
+    MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network, const Config &cfg,
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+
+    /**
+     * @brief Compiles graphs from an imported network, which is already prepared, taking the decisions of
+     * the exported graph compilation
+     */
+    MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network, const Config &cfg,
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const std::shared_ptr<const CompiledGraphInfo> &compiledInfo);
+
+    ~MKLDNNExecNetwork() override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * @brief Only CPU_PROFILING_TRACE is accepted: the trace recorded so far is written to the given file
+     */
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
+    /**
+     * @brief Remembers the config passed to LoadNetwork, so it can be exported later
+     */
+    void setLoadConfig(const std::map<std::string, std::string> &config);
+
+    /**
+     * @brief Converts the loaded network reshaped to given input shapes into a network graphs are compiled from
+     */
+    using NetworkConverter = std::function<InferenceEngine::details::CNNNetworkImplPtr(
+        const InferenceEngine::ICNNNetwork&, const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
+    /**
+     * @brief Allows to compile graphs for input shapes other than the loaded network ones (CPU_SHAPE_CACHE_SIZE)
+     * @param network The loaded network, it is not modified by the converter
+     */
+    void setNetworkConverter(const InferenceEngine::ICNNNetwork::Ptr &network, const NetworkConverter &converter);
+
+    /**
+     * @brief Returns a graph of the calling stream compiled for given input shapes. Graphs for recently used shapes
+     * are kept in a cache, the network is converted and compiled again for other ones.
+     */
+    MKLDNNGraph::Ptr GetGraph(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -54,9 +103,32 @@ protected:
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
+    std::vector<std::weak_ptr<MKLDNNGraph>>     _createdGraphs;  // guarded by _cfgMutex
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
-
+    std::map<std::string, std::string>          _loadConfig;
+    std::unique_ptr<PerfTrace>                  _perfTrace;
+    std::ofstream                               _perfTraceFile;
+    NumaNodesWeights                           &_numaNodesWeights;
+
+    // graphs of all streams compiled for the same input shapes
+    struct ShapeVariant {
+        ShapeVariant(const InferenceEngine::details::CNNNetworkImplPtr &network_,
+                     const std::function<MKLDNNGraph::Ptr()> &createGraph) : network(network_), graphs(createGraph) {}
+
+        InferenceEngine::details::CNNNetworkImplPtr     network;
+        InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  graphs;
+    };
+    using ShapeCache = std::list<std::pair<InferenceEngine::ICNNNetwork::InputShapes, std::shared_ptr<ShapeVariant>>>;
+
+    InferenceEngine::ICNNNetwork::Ptr           _reshapableNetwork;
+    NetworkConverter                            _networkConverter;
+    std::mutex                                  _shapeCacheMutex;
+    ShapeCache                                  _shapeCache;  // the most recently used shapes first
+
+    void prepareNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network);
+    MKLDNNGraph::Ptr createGraph(const InferenceEngine::details::CNNNetworkImpl &network,
+                                 const std::shared_ptr<const CompiledGraphInfo> &compiledInfo = nullptr);
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
 };
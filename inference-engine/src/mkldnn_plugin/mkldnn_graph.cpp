@@ -12,6 +12,11 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
+#include <atomic>
+#include <functional>
+#include <set>
+#include <iterator>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -33,9 +38,15 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/blob_dump.h"
 
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
+
 /*****************************************************
  * Debug capability
  *  - BLOB_DUMP_PATH : Specify with existing folder name
@@ -62,6 +73,59 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+/**
+ * Calls func for every node in parallel. Nodes must not depend on each other's results.
+ * Extension layers are not required to be thread-safe, so generic nodes are handled one by one afterwards.
+ * Exceptions are rethrown in the node order, so the reported error does not depend on scheduling.
+ */
+template <typename F>
+void parallelForNodes(const std::vector<MKLDNNNodePtr> &nodes, const F &func) {
+    std::vector<std::exception_ptr> errors(nodes.size());
+    auto call = [&](size_t i) {
+        try {
+            func(nodes[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    parallel_for(nodes.size(), [&](size_t i) {
+        if (nodes[i]->getType() != Generic)
+            call(i);
+    });
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i]->getType() == Generic)
+            call(i);
+    }
+    for (auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+MKLDNNMemoryPtr createWorkspace(const mkldnn::engine& eng, size_t size) {
+    auto workspace = std::make_shared<MKLDNNMemory>(eng);
+    workspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)));
+    return workspace;
+}
+
+/**
+ * Graphs bound to one thread are never executed concurrently, so the largest workspace created
+ * by a thread is reused by all graphs created by this thread later.
+ */
+MKLDNNMemoryPtr getThreadWorkspace(const mkldnn::engine& eng, size_t size) {
+    static thread_local std::weak_ptr<MKLDNNMemory> threadWorkspace;
+    auto workspace = threadWorkspace.lock();
+    if (!workspace || workspace->GetSize() < size) {
+        workspace = createWorkspace(eng, size);
+        threadWorkspace = workspace;
+    }
+    return workspace;
+}
+
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::ApplyUnrollPasses(NET &net) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::ApplyUnrollPasses");
@@ -98,6 +162,12 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
 
     Replicate(net, extMgr);
     InitGraph();
+
+    perfTraceNames.assign(graphNodes.size(), 0);
+    if (perfTrace) {
+        for (size_t i = 0; i < graphNodes.size(); i++)
+            perfTraceNames[i] = perfTrace->intern(graphNodes[i]->getName());
+    }
     status = Ready;
 }
 
@@ -353,6 +423,8 @@ void MKLDNNGraph::InitGraph() {
 
     SetOriginalLayerNames();
 
+    InitParallelExecution();
+
     if (!config.dumpToDot.empty())
         dumpToDotFile(config.dumpToDot + "_init.dot");
 
@@ -416,30 +488,76 @@ void MKLDNNGraph::InitNodes() {
 }
 
 void MKLDNNGraph::InitDescriptors() {
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitDescriptors");
 
-    for (auto &node : graphNodes) {
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    for (auto &node : graphNodes) {
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
+    }
 #endif
-        OV_ITT_TASK_NEXT(taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
 
-        OV_ITT_TASK_NEXT(taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
-
-        OV_ITT_TASK_NEXT(taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
+    // isConstant() caches its result in the node and in-place checks call it for neighbour nodes,
+    // so it is resolved for all nodes before the parallel section, which then only reads it
+    for (auto &node : graphNodes) {
+        node->isConstant();
     }
 
+    // Supported descriptors of a node depend only on its own layer and edge dims,
+    // so enumeration (including mkl-dnn primitive descriptor iteration) runs in parallel.
+    parallelForNodes(graphNodes, [](const MKLDNNNodePtr &node) {
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    });
+
+    // Decisions of an imported network are taken again if it is compiled into other nodes
+    bool useImportedInfo = importedInfo && importedInfo->nodes.size() == graphNodes.size() &&
+        std::all_of(graphNodes.begin(), graphNodes.end(), [&](const MKLDNNNodePtr &node) {
+            return importedInfo->nodes.count(node->getName()) != 0;
+        });
+
+    // Selection looks at parents' choices, so it follows the topological order
     for (auto &node : graphNodes) {
-        OV_ITT_TASK_NEXT(taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.selectOptimalPrimitiveDescriptor);
+        const CompiledGraphInfo::Node *imported = useImportedInfo ? &importedInfo->nodes.at(node->getName()) : nullptr;
+        const auto &supported = node->getSupportedPrimitiveDescriptors();
+        if (imported && imported->selectedDescriptor >= 0 &&
+                imported->selectedDescriptor < static_cast<int>(supported.size()) &&
+                supported[imported->selectedDescriptor].getImplementationType() == imported->implType) {
+            node->selectPrimitiveDescriptorByIndex(imported->selectedDescriptor);
+            node->packedWeights = imported->packedWeights;
+        } else {
+            node->selectOptimalPrimitiveDescriptor();
+        }
+
+        auto &selected = compiledInfo.nodes[node->getName()];
+        selected.selectedDescriptor = node->selectedPrimitiveDescriptorIndex;
+        if (auto pd = node->getSelectedPrimitiveDescriptor())
+            selected.implType = pd->getImplementationType();
+    }
+}
+
+CompiledGraphInfo MKLDNNGraph::GetCompiledInfo() const {
+    CompiledGraphInfo info = compiledInfo;
+    for (const auto &graphNode : graphNodes) {
+        auto found = info.nodes.find(graphNode->getName());
+        if (found != info.nodes.end())
+            found->second.packedWeights = graphNode->packedWeights;
     }
+    return info;
 }
 
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
@@ -570,6 +688,7 @@ void MKLDNNGraph::AllocateWithReuse() {
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    std::vector<bool> ownMemoryClasters(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
@@ -620,23 +739,36 @@ void MKLDNNGraph::AllocateWithReuse() {
         }
 
         box.size = div_up(box.size, alignment);
+
+        // Network outputs get their own memory outside of the workspace. Infer requests usually
+        // switch these edges to user blobs (see MKLDNNInferRequest::changeDefaultPtr), so there is
+        // no reason to keep a solver slot for them.
+        // Shared workspace is overwritten by other graphs between inferences. Constants and input data
+        // have to survive that, so they are kept in graph own memory as well.
+        if (isOutput || (shareWorkspace && (isConst || isInput))) {
+            ownMemoryClasters[i] = true;
+            box.size = 0;
+        }
     }
 
     MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    workspaceSize = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    memWorkspace = shareWorkspace ? getThreadWorkspace(eng, workspaceSize) : createWorkspace(eng, workspaceSize);
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
-                // !! Fallback to individual memory allocation !!
-                // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                if (ownMemoryClasters[i]) {
+                    edge->allocate();
+                } else {
+                    int64_t offset = memSolver.getOffset(i);
+                    // !! Fallback to individual memory allocation !!
+                    // if you like to check infer without reuse just call this function without arguments.
+                    edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                }
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -649,6 +781,52 @@ void MKLDNNGraph::AllocateWithReuse() {
         }
         IE_ASSERT(count == 1);
     }
+
+    memoryReuseDeps.clear();
+    if (config.interNodeParallelism) {
+        // Memory solver shares workspace between clusters with non-overlapping lifetimes in execution order.
+        // Keep that order for the dataflow executor: nodes writing a cluster wait for all users of the clusters
+        // which held its memory last. Earlier holders are ordered through them, so only the last ones are tracked.
+        std::vector<int> order;
+        for (int i = 0; i < edge_clasters.size(); i++) {
+            if (boxes[i].size != 0 && !ownMemoryClasters[i])
+                order.push_back(i);
+        }
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return boxes[a].start < boxes[b].start; });
+
+        // workspace offset -> cluster which held the memory from this offset up to the next one last (-1 if none)
+        std::map<int64_t, int> holders = {{0, -1}};
+        auto split = [&](int64_t offset) {
+            auto it = std::prev(holders.upper_bound(offset));
+            return it->first == offset ? it : holders.emplace_hint(std::next(it), offset, it->second);
+        };
+        for (int j : order) {
+            int64_t offset = memSolver.getOffset(j);
+            auto first = split(offset), last = split(offset + boxes[j].size);
+            std::set<int> previous;
+            for (auto it = first; it != last; it++) {
+                if (it->second != -1 && boxes[it->second].finish != -1)
+                    previous.insert(it->second);
+            }
+            holders.erase(first, last);
+            holders.emplace(offset, j);
+
+            std::set<int> writers;
+            for (auto &edge : edge_clasters[j])
+                writers.insert(edge->getParent()->execIndex);
+            std::set<int> users;
+            for (int i : previous) {
+                for (auto &edge : edge_clasters[i]) {
+                    users.insert(edge->getParent()->execIndex);
+                    users.insert(edge->getChild()->execIndex);
+                }
+            }
+            for (int user : users) {
+                for (int writer : writers)
+                    memoryReuseDeps.emplace_back(user, writer);
+            }
+        }
+    }
 }
 
 void MKLDNNGraph::Allocate() {
@@ -667,14 +845,38 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    // Remember graph owned memory of input/output edges. Infer requests may switch them to user blobs.
+    ioDefaultPtrs.clear();
+    for (auto& input : inputNodes) {
+        if (input.second->isConstant())
+            continue;
+        for (size_t i = 0; i < input.second->getChildEdges().size(); i++) {
+            auto edge = input.second->getChildEdgeAt(i);
+            ioDefaultPtrs[input.first].emplace_back(edge, edge->getMemory().GetPrimitive().get_data_handle());
+        }
+    }
+    for (auto& output : outputNodes) {
+        auto edge = output->getParentEdgeAt(0);
+        ioDefaultPtrs[output->getName().substr(4)].emplace_back(edge, edge->getMemory().GetPrimitive().get_data_handle());
+    }
 }
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // Memory is already allocated and descriptors are fixed, so primitives (and their JIT kernels)
+    // are created independently
+    parallelForNodes(graphNodes, [](const MKLDNNNodePtr &node) {
         OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
-    }
+    });
+}
+
+bool MKLDNNGraph::canNormalizeInput(const std::string& name, const InferenceEngine::Blob::Ptr &in) const {
+    auto meanImage = _meanImages.find(name);
+    auto input = inputNodes.find(name);
+    return meanImage != _meanImages.end() && input != inputNodes.end() &&
+           meanImage->second.CanNormalize(in, input->second->getChildEdgeAt(0)->getMemory());
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -682,6 +884,11 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
+        // precision conversion, mean/scale and layout change are done in one pass when possible
+        auto meanImage = _meanImages.find(name);
+        if (meanImage != _meanImages.end() && meanImage->second.Normalize(in, input->second->getChildEdgeAt(0)->getMemory()))
+            return;
+
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
 
         const void *ext_data_ptr = in->cbuffer();
@@ -760,14 +967,103 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::InitParallelExecution() {
+    execSuccessors.clear();
+    execPredecessorsNum.clear();
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (!config.interNodeParallelism)
+        return;
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitParallelExecution");
+
+    std::vector<std::set<int>> successors(graphNodes.size());
+    auto addDependency = [&](int from, int to) {
+        if (from < 0 || to < 0 || from == to)
+            return;
+        // execIndex is a topological order, so dependencies never form a cycle
+        IE_ASSERT(from < to);
+        successors[from].insert(to);
+    };
+
+    // Memory nodes pass state to each other outside of graph edges, keep their relative order
+    int lastMemoryNode = -1;
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto &node = graphNodes[i];
+        for (size_t j = 0; j < node->getParentEdges().size(); j++)
+            addDependency(node->getParentEdgeAt(j)->getParent()->execIndex, i);
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput) {
+            addDependency(lastMemoryNode, i);
+            lastMemoryNode = i;
+        }
+    }
+    for (auto &dep : memoryReuseDeps)
+        addDependency(dep.first, dep.second);
+
+    execSuccessors.resize(graphNodes.size());
+    execPredecessorsNum.assign(graphNodes.size(), 0);
+    for (int i = 0; i < graphNodes.size(); i++) {
+        execSuccessors[i].assign(successors[i].begin(), successors[i].end());
+        for (int child : successors[i])
+            execPredecessorsNum[child]++;
+    }
+#endif
+}
+
+void MKLDNNGraph::InferParallel() {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    std::vector<std::atomic<int>> pending(graphNodes.size());
+    for (int i = 0; i < graphNodes.size(); i++)
+        pending[i] = execPredecessorsNum[i];
+
+    tbb::task_group taskGroup;
+    std::function<void(int)> executeNode = [&](int i) {
+        auto &node = graphNodes[i];
+        PERF_TRACE(node, node->isConstant() ? nullptr : perfTrace, perfTraceNames[i], streamId);
+
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+        if (!node->isConstant()) {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+            // Isolation prevents the thread from picking up another node while it waits inside
+            // this node's parallel regions, so thread-local scratchpads are not shared between nodes
+            tbb::this_task_arena::isolate([&] { node->execute(stream); });
+        }
+
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+
+        for (int child : execSuccessors[i]) {
+            if (--pending[child] == 0)
+                taskGroup.run([&executeNode, child] { executeNode(child); });
+        }
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        if (execPredecessorsNum[i] == 0)
+            taskGroup.run([&executeNode, i] { executeNode(i); });
+    }
+    taskGroup.wait();
+#endif
+}
+
 void MKLDNNGraph::Infer(int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    if (!execSuccessors.empty()) {
+        if (batch > 0) {
+            for (auto &node : graphNodes)
+                node->setDynamicBatchLim(batch);
+        }
+        InferParallel();
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+        PERF_TRACE(graphNodes[i], graphNodes[i]->isConstant() ? nullptr : perfTrace, perfTraceNames[i], streamId);
 
         if (batch > 0)
             graphNodes[i]->setDynamicBatchLim(batch);
@@ -16,9 +16,24 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Decisions taken while a graph is compiled, which are exported with the network so an imported one reuses them:
+ * primitive descriptors selected for the nodes and weights already packed into the layouts of the selected primitives
+ */
+struct CompiledGraphInfo {
+    struct Node {
+        int selectedDescriptor = -1;
+        impl_desc_type implType = impl_desc_type::unknown;
+        std::vector<MKLDNNMemoryPtr> packedWeights;
+    };
+    // nodes of the graph after common optimizations by name
+    std::map<std::string, Node> nodes;
+};
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -55,6 +70,11 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
+    /**
+     * Checks if PushInputData converts the input to FP32 together with mean image subtraction
+     */
+    bool canNormalizeInput(const std::string& name, const InferenceEngine::Blob::Ptr &in) const;
+
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
@@ -87,6 +107,43 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /** Size in bytes of the workspace shared by intermediate tensors */
+    size_t GetWorkspaceSize() const {
+        return workspaceSize;
+    }
+
+    /**
+     * Place intermediate tensors into a workspace shared with other graphs created by the same thread.
+     * Such graphs must be executed only by that thread, which is the case for graphs bound to a stream.
+     * Should be called before CreateGraph.
+     */
+    void ShareWorkspaceWithThreadGraphs(bool share) {
+        shareWorkspace = share;
+    }
+
+    /**
+     * Makes the graph record executed nodes into the trace on behalf of the given stream.
+     * Should be called before CreateGraph.
+     */
+    void SetPerfTrace(PerfTrace *trace, int stream) {
+        perfTrace = trace;
+        streamId = stream;
+    }
+
+    /**
+     * Makes the graph take the decisions recorded by another compilation of the same network instead of taking them
+     * again. They are ignored if the network is compiled into other nodes (e.g. for another instruction set).
+     * Should be called before CreateGraph.
+     */
+    void SetCompiledInfo(const std::shared_ptr<const CompiledGraphInfo>& info) {
+        importedInfo = info;
+    }
+
+    /**
+     * Returns the decisions taken by the graph compilation
+     */
+    CompiledGraphInfo GetCompiledInfo() const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -135,6 +192,11 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        execSuccessors.clear();
+        execPredecessorsNum.clear();
+        memoryReuseDeps.clear();
+        ioDefaultPtrs.clear();
+        compiledInfo.nodes.clear();
     }
     Status status;
     Config config;
@@ -146,6 +208,27 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    size_t workspaceSize = 0;
+    bool shareWorkspace = false;
+
+    PerfTrace *perfTrace = nullptr;
+    int streamId = 0;
+    // ids of the node names in the trace, indexed as graphNodes
+    std::vector<size_t> perfTraceNames;
+
+    std::shared_ptr<const CompiledGraphInfo> importedInfo;
+    // primitive descriptors selected by InitDescriptors, packed weights are collected on request
+    CompiledGraphInfo compiledInfo;
+
+    // Graph owned memory of input/output edges by blob name
+    std::map<std::string, std::vector<std::pair<MKLDNNEdgePtr, void*>>> ioDefaultPtrs;
+
+    // Dataflow schedule for config.interNodeParallelism, indexed by node execIndex.
+    // Empty if nodes are executed sequentially.
+    std::vector<std::vector<int>> execSuccessors;
+    std::vector<int> execPredecessorsNum;
+    // Pairs of execIndex (from, to): 'to' writes memory which 'from' still uses in sequential order
+    std::vector<std::pair<int, int>> memoryReuseDeps;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -169,6 +252,8 @@ protected:
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
+    void InitParallelExecution();
+    void InferParallel();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
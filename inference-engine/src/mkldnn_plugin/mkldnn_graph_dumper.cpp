@@ -275,6 +275,8 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
     // Performance
     if (node->PerfCounter().avg() != 0) {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(node->PerfCounter().avg());
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P50] = std::to_string(node->PerfCounter().percentile(0.5));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P99] = std::to_string(node->PerfCounter().percentile(0.99));
     } else {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <cstring>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -67,6 +68,68 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
 }
 
+namespace {
+
+// Copies the blob into a blob with greater dims, the rest of elements is zero after the padded blob is cleared
+void padBlob(const InferenceEngine::Blob::Ptr& blob, const InferenceEngine::Blob::Ptr& padded, bool clear) {
+    const auto& desc = blob->getTensorDesc();
+    const auto& blocking = desc.getBlockingDesc();
+    const auto& dims = padded->getTensorDesc().getDims();
+    const size_t elemSize = desc.getPrecision().size();
+    auto dst = padded->buffer().as<uint8_t*>();
+    if (clear)
+        std::memset(dst, 0, padded->byteSize());
+    if (dims.empty()) {
+        std::memcpy(dst, blob->cbuffer().as<const uint8_t*>(), elemSize);
+        return;
+    }
+
+    // rows along the innermost dimension are copied one by one
+    const size_t rank = dims.size();
+    const auto& srcDims = blocking.getBlockDims();
+    const auto& srcStrides = blocking.getStrides();
+    const auto& dstStrides = padded->getTensorDesc().getBlockingDesc().getStrides();
+    auto src = blob->cbuffer().as<const uint8_t*>() + blocking.getOffsetPadding() * elemSize;
+    size_t rows = 1;
+    for (size_t i = 0; i + 1 < rank; i++)
+        rows *= srcDims[i];
+    InferenceEngine::SizeVector idx(rank, 0);
+    for (size_t row = 0; row < rows; row++) {
+        size_t srcOffset = 0, dstOffset = 0;
+        for (size_t i = 0; i + 1 < rank; i++) {
+            srcOffset += idx[i] * srcStrides[i];
+            dstOffset += idx[i] * dstStrides[i];
+        }
+        if (srcStrides[rank - 1] == 1) {
+            std::memcpy(dst + dstOffset * elemSize, src + srcOffset * elemSize, srcDims[rank - 1] * elemSize);
+        } else {
+            for (size_t j = 0; j < srcDims[rank - 1]; j++)
+                std::memcpy(dst + (dstOffset + j) * elemSize, src + (srcOffset + j * srcStrides[rank - 1]) * elemSize, elemSize);
+        }
+        for (size_t i = rank - 1; i-- > 0;) {
+            if (++idx[i] < srcDims[i])
+                break;
+            idx[i] = 0;
+        }
+    }
+}
+
+// ROI and padded blobs have an offset or strides of a greater blob
+bool isDense(const InferenceEngine::TensorDesc& desc) {
+    const auto& blocking = desc.getBlockingDesc();
+    if (blocking.getOffsetPadding() != 0)
+        return false;
+    size_t stride = 1;
+    for (size_t i = blocking.getBlockDims().size(); i-- > 0;) {
+        if (blocking.getStrides()[i] != stride)
+            return false;
+        stride *= blocking.getBlockDims()[i];
+    }
+    return true;
+}
+
+}  // namespace
+
 void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
 
@@ -76,6 +139,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
+        // the conversion reads elements one after another, so sparse blobs are gathered first
+        auto srcBlob = inputBlob;
+        const auto& srcDesc = inputBlob->getTensorDesc();
+        if (!isDense(srcDesc) && srcDesc.getBlockingDesc().getBlockDims().size() == srcDesc.getDims().size()) {
+            srcBlob = make_blob_with_precision(InferenceEngine::TensorDesc(srcDesc.getPrecision(), srcDesc.getDims(),
+                                                                           srcDesc.getLayout()));
+            srcBlob->allocate();
+            padBlob(inputBlob, srcBlob, false);
+        }
+
         iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
                                          inputBlob->getTensorDesc().getLayout()));
         iconv->allocate();
@@ -83,18 +156,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
             THROW_IE_EXCEPTION << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
 
-        void *srcData = inputBlob->cbuffer().as<void *>();
+        void *srcData = srcBlob->cbuffer().as<void *>();
         void *dstData = iconv->buffer().as<void *>();
         if (dstData == nullptr) {
             THROW_IE_EXCEPTION << "Converted input blob has no allocated memory";
         }
-        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
+        cpu_convert(srcData, dstData, srcBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
+    // with the shape cache, inputs can be smaller than the selected graph ones, the network graph included:
+    // the dims rounded up to the bucket may be the network ones
+    InferenceEngine::BlobMap graphInputs;
+    if (graph->getProperty().shapeCacheSize > 0)
+        graph->getInputBlobs(graphInputs);
+
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             THROW_IE_EXCEPTION << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
@@ -103,6 +182,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
 
         switch (inPrec) {
             // these precisions are supported by mkldnn, so we push the blob directly
+            // (U8 with a mean image is checked below, once the blob to push is known)
+            case InferenceEngine::Precision::U8:
             case InferenceEngine::Precision::I8:
             case InferenceEngine::Precision::I32:
             case InferenceEngine::Precision::BF16:
@@ -111,7 +192,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             }
             // these precisions are supported by mkldnn, so we push the blob directly
             // BUT if a mean image exists, we convert the blob and send FP32
-            case InferenceEngine::Precision::U8:
             case InferenceEngine::Precision::BOOL:
             case InferenceEngine::Precision::I16: {
                 if (graph->hasMeanImageFor(input.first))
@@ -128,7 +208,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             default:
                 THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
         }
-        pushInput(input.first, input.second, inPrec);
+        auto inputBlob = input.second;
+        auto graphInput = graphInputs.find(input.first);
+        if (graphInput != graphInputs.end() &&
+                graphInput->second->getTensorDesc().getDims() != inputBlob->getTensorDesc().getDims()) {
+            // the graph was compiled for a bucket of shapes
+            const auto& desc = inputBlob->getTensorDesc();
+            const auto& dims = graphInput->second->getTensorDesc().getDims();
+            if (desc.getBlockingDesc().getBlockDims().size() != dims.size() || desc.getDims().size() != dims.size())
+                THROW_IE_EXCEPTION << "Input blob of " << desc.getLayout() << " layout cannot be padded to a shape bucket";
+            auto& padded = paddedInputs[input.first];
+            const bool reallocate = !padded.blob || padded.blob->getTensorDesc().getDims() != dims ||
+                                    padded.blob->getTensorDesc().getPrecision() != desc.getPrecision() ||
+                                    padded.blob->getTensorDesc().getLayout() != desc.getLayout();
+            if (reallocate) {
+                padded.blob = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims, desc.getLayout()));
+                padded.blob->allocate();
+            }
+            // elements outside of the input stay zero while inputs of the same shape are padded
+            padBlob(inputBlob, padded.blob, reallocate || padded.srcDims != desc.getDims());
+            padded.srcDims = desc.getDims();
+            inputBlob = padded.blob;
+        }
+        // U8 is converted to FP32 by the graph together with mean image subtraction if it supports the blob
+        if (inPrec == InferenceEngine::Precision::U8 && graph->hasMeanImageFor(input.first) &&
+                !graph->canNormalizeInput(input.first, inputBlob))
+            inPrec = InferenceEngine::Precision::FP32;
+        pushInput(input.first, inputBlob, inPrec);
     }
 }
 
@@ -137,6 +243,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
     graph = execNetwork->_graphs.local().get();
+    if (graph->getProperty().shapeCacheSize > 0)
+        selectGraph();
 
     execDataPreprocessing(_inputs);
 
@@ -149,6 +257,84 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::selectGraph() {
+    const size_t bucket = graph->getProperty().shapeBucket;
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    bool networkShapes = true;
+    for (const auto& input : _networkInputs) {
+        const auto& networkDims = input.second->getTensorDesc().getDims();
+        auto dims = _inputs[input.first]->getTensorDesc().getDims();
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (dims[i] != networkDims[i])
+                dims[i] = (dims[i] + bucket - 1) / bucket * bucket;
+        }
+        networkShapes = networkShapes && dims == networkDims;
+        shapes[input.first] = dims;
+    }
+    if (networkShapes) {
+        shapeGraph.reset();
+    } else {
+        shapeGraph = execNetwork->GetGraph(shapes);
+        graph = shapeGraph.get();
+    }
+
+    // Blobs of other shapes than the graph ones can't be used as graph memory directly
+    InferenceEngine::BlobMap graphInputs;
+    graph->getInputBlobs(graphInputs);
+    for (auto& input : _inputs) {
+        auto graphInput = graphInputs.find(input.first);
+        if (graphInput == graphInputs.end())
+            continue;
+        const auto& desc = input.second->getTensorDesc();
+        if (desc.getDims() == graphInput->second->getTensorDesc().getDims() &&
+                desc.getPrecision() == graphInput->second->getTensorDesc().getPrecision() &&
+                graph->_meanImages.find(input.first) == graph->_meanImages.end()) {
+            externalPtr[input.first] = input.second->buffer();
+        } else {
+            externalPtr.erase(input.first);
+        }
+    }
+
+    // Output blobs take shapes of the graph
+    InferenceEngine::BlobMap graphOutputs;
+    graph->getOutputBlobs(graphOutputs);
+    for (auto& graphOutput : graphOutputs) {
+        auto& output = _outputs[graphOutput.first];
+        const auto& desc = graphOutput.second->getTensorDesc();
+        if (!output || output->getTensorDesc().getDims() != desc.getDims()) {
+            if (userOutputs.count(graphOutput.first)) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Output blob " << graphOutput.first
+                                   << " does not have the shape of the graph compiled for the input shapes";
+            }
+            auto precision = output ? output->getTensorDesc().getPrecision() : desc.getPrecision();
+            auto blockingDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
+            output = make_blob_with_precision(InferenceEngine::TensorDesc(precision, desc.getDims(), blockingDesc));
+            output->allocate();
+        }
+        if (output->getTensorDesc().getPrecision() == desc.getPrecision()) {
+            externalPtr[graphOutput.first] = output->buffer();
+        } else {
+            externalPtr.erase(graphOutput.first);
+        }
+    }
+}
+
+InferenceEngine::SizeVector MKLDNNPlugin::MKLDNNInferRequest::refDims(const InferenceEngine::Blob::Ptr& blob) const {
+    // blobs of any shapes are accepted when graphs are compiled for them on demand
+    if (blob && graph->getProperty().shapeCacheSize > 0)
+        return blob->getTensorDesc().getDims();
+    return {};
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, refDims(input.second));
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, refDims(output.second));
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
@@ -175,7 +361,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, refDims(data));
             return;
         }
 
@@ -204,7 +390,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, refDims(data));
             return;
         }
 
@@ -219,7 +405,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _outputs[name] = make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        // blob has the same precision as the graph output, so the graph can write into it directly
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -271,21 +458,25 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
                 : 1;
-            if (dataSize != inputSize) {
+            // with shape cache any input shape of the same rank and layout is accepted
+            const bool anyShape = graph->getProperty().shapeCacheSize > 0;
+            if (!anyShape && dataSize != inputSize) {
                 THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+            if (anyShape ? foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()
+                         : foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions mismatch.";
             }
 
             if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                (anyShape ? foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()
+                          : foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc())) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+            if (data->getTensorDesc().getPrecision() == graphBlobPrecision(name, true) &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -305,24 +496,29 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
             ? InferenceEngine::details::product(foundOutput->getDims())
             : 1;
-        if (dataSize != outputSize) {
+        // with shape cache the output shape is checked during inference, when a graph is selected for the inputs
+        const bool anyShape = graph->getProperty().shapeCacheSize > 0;
+        if (!anyShape && dataSize != outputSize) {
             THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
                                << dataSize << "!=" << outputSize << ").";
         }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+        if (anyShape ? foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()
+                     : foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
         }
         if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+            (anyShape ? foundOutput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()
+                      : foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc())) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+        if (data->getTensorDesc().getPrecision() == graphBlobPrecision(name, false) &&
                 !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputs.insert(name);
     }
 }
 
@@ -330,7 +526,33 @@ static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
+InferenceEngine::Precision MKLDNNPlugin::MKLDNNInferRequest::graphBlobPrecision(const std::string& name, bool isInput) const {
+    InferenceEngine::BlobMap blobs;
+    if (isInput)
+        graph->getInputBlobs(blobs);
+    else
+        graph->getOutputBlobs(blobs);
+    auto blob = blobs.find(name);
+    return blob != blobs.end() ? blob->second->getTensorDesc().getPrecision() : InferenceEngine::Precision::UNSPECIFIED;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::restoreDefaultPtr(const std::string& name) {
+    auto io = graph->ioDefaultPtrs.find(name);
+    if (io == graph->ioDefaultPtrs.end())
+        return;
+    for (auto& edgePtr : io->second) {
+        if (edgePtr.first->getMemory().GetPrimitive().get_data_handle() != edgePtr.second)
+            changeEdgePtr(edgePtr.first, edgePtr.second);
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
+    // The graph is shared between requests of a stream, so edges may still point to blobs of another request
+    for (auto& io : graph->ioDefaultPtrs) {
+        if (externalPtr.find(io.first) == externalPtr.end())
+            restoreDefaultPtr(io.first);
+    }
+
     for (auto& it : externalPtr) {
         auto input = graph->inputNodes.find(it.first);
         if (input != graph->inputNodes.end()) {
@@ -362,8 +584,12 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
                         canBeInPlace = false;
                 }
             }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
+            if (canBeInPlace) {
+                for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
+                    changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
+                }
+            } else {
+                restoreDefaultPtr(it.first);
             }
             continue;
         }
@@ -399,6 +625,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             } while (previousParent != parent);
             if (canBeInPlace)
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            else
+                restoreDefaultPtr(it.first);
             continue;
         }
         THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
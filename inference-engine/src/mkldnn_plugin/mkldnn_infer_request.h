@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -45,14 +46,28 @@ public:
 
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    void checkBlobs() override;
+
 private:
+    void selectGraph();
+    InferenceEngine::SizeVector refDims(const InferenceEngine::Blob::Ptr& blob) const;
     void PushInputData();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    void restoreDefaultPtr(const std::string& name);
+    InferenceEngine::Precision graphBlobPrecision(const std::string& name, bool isInput) const;
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    MKLDNNGraph::Ptr                    shapeGraph;  // a graph compiled for other input shapes is kept alive when evicted
+    std::set<std::string>               userOutputs;  // output blobs set by a user are filled, never replaced
+    // input blobs padded to a shape bucket are reused while the selected graph has the same input shapes
+    struct PaddedInput {
+        InferenceEngine::Blob::Ptr blob;
+        InferenceEngine::SizeVector srcDims;
+    };
+    std::map<std::string, PaddedInput>  paddedInputs;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
@@ -7,6 +7,8 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -45,55 +47,158 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+namespace {
+
+using Box = MemorySolver::Box;
+
+struct Placed { const Box* box; int64_t offset; };
+
+/**
+ * Index of placed boxes by live time. A box overlaps [start, finish] either if it is alive at start
+ * or if it is produced later within the range, both sets are found without visiting other boxes:
+ *  - boxes alive at a time stamp are kept in segment tree nodes covered by their live time
+ *  - boxes are also ordered by start
+ */
+class LiveTimeIndex {
+public:
+    explicit LiveTimeIndex(int duration) {
+        while (_leaves < duration) _leaves *= 2;
+        _alive.resize(2 * _leaves);
+    }
+
+    void add(const Placed& placed) {
+        for (int l = placed.box->start + _leaves, r = placed.box->finish + 1 + _leaves; l < r; l /= 2, r /= 2) {
+            if (l & 1) _alive[l++].push_back(placed);
+            if (r & 1) _alive[--r].push_back(placed);
+        }
+        _started.emplace(placed.box->start, placed);
     }
+
+    void overlapped(const Box& box, std::vector<Placed>& result) const {
+        result.clear();
+        for (int node = box.start + _leaves; node > 0; node /= 2)
+            result.insert(result.end(), _alive[node].begin(), _alive[node].end());
+        for (auto it = _started.upper_bound(box.start); it != _started.end() && it->first <= box.finish; ++it)
+            result.push_back(it->second);
+    }
+
+private:
+    int _leaves = 1;
+    std::vector<std::vector<Placed>> _alive;
+    std::multimap<int, Placed> _started;
+};
+
+/**
+ * Places boxes one by one in provided order. Each box is put into a free gap on Mem axis
+ * which is not occupied by already placed boxes with intersected live time.
+ *  - first fit: the lowest gap (equal to popping the box up from the bottom)
+ *  - best fit: the smallest gap which is big enough, top of others if there is no such gap
+ */
+int64_t placeBoxes(const std::vector<const Box*>& order, int duration, bool best_fit,
+                   std::map<int64_t, int64_t>& offsets) {
+    LiveTimeIndex placed(duration);
+    std::vector<Placed> neighbours;
+    offsets.clear();
+
+    int64_t min_required = 0;
+    for (const Box* box : order) {
+        if (box->size == 0) {
+            offsets[box->id] = 0;
+            continue;
+        }
+
+        placed.overlapped(*box, neighbours);
+        std::sort(neighbours.begin(), neighbours.end(),
+                  [](const Placed& l, const Placed& r) { return l.offset < r.offset; });
+
+        int64_t offset = -1, gap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (const auto& n : neighbours) {
+            int64_t free_space = n.offset - top;
+            if (free_space >= box->size && free_space < gap) {
+                offset = top;
+                gap = free_space;
+                if (!best_fit || gap == box->size) break;
+            }
+            top = std::max(top, n.offset + n.box->size);
+        }
+        if (offset == -1) offset = top;
+
+        placed.add({box, offset});
+        offsets[box->id] = offset;
+        min_required = std::max(min_required, offset + box->size);
+    }
+    return min_required;
 }
 
+}  // namespace
+
 int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int64_t _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
-            }
-        } while (popped_up);
+    // Required memory can't be less than max sum of box sizes alive at the same time
+    const int64_t lower_bound = maxDepth();
+
+    using Comparator = bool (*)(const Box*, const Box*);
+    const std::vector<std::pair<Comparator, bool>> strategies {
+        // biggest first, first fit. The original greedy approach, keep it first to never be worse.
+        {[](const Box* l, const Box* r) { return l->size > r->size; }, false},
+        {[](const Box* l, const Box* r) { return l->size > r->size; }, true},
+        // biggest area (size * live time) first
+        {[](const Box* l, const Box* r) {
+            return l->size * (l->finish - l->start + 1) > r->size * (r->finish - r->start + 1); }, true},
+        // longest living first, ties broken by size
+        {[](const Box* l, const Box* r) {
+            return l->finish - l->start > r->finish - r->start ||
+                  (l->finish - l->start == r->finish - r->start && l->size > r->size); }, true},
+        // in order of production, like an allocator would do at runtime
+        {[](const Box* l, const Box* r) {
+            return l->start < r->start || (l->start == r->start && l->size > r->size); }, true},
+    };
+
+    std::vector<const Box*> initial_order(_boxes.size());
+    int duration = 0;
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        initial_order[i] = &_boxes[i];
+        duration = std::max(duration, _boxes[i].finish + 1);
+    }
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+    int64_t min_required = std::numeric_limits<int64_t>::max();
+    std::vector<const Box*> best_order;
+    bool best_fit = false;
+    std::map<int64_t, int64_t> offsets;
+    for (const auto& strategy : strategies) {
+        auto order = initial_order;
+        std::stable_sort(order.begin(), order.end(), strategy.first);
+        int64_t required = placeBoxes(order, duration, strategy.second, offsets);
+        if (required < min_required) {
+            min_required = required;
+            best_order = std::move(order);
+            best_fit = strategy.second;
+            _offsets.swap(offsets);
+        }
+        if (min_required <= lower_bound) return min_required;
+    }
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+    // Greedy placement is mostly limited by boxes which define the top bound. Try to place them
+    // earlier to let the rest fill the gaps around. A few attempts are enough in practice. Each attempt
+    // costs as much as a strategy pass, so huge box sets are left with the best greedy result.
+    const size_t max_refined_boxes = 4096;
+    const int max_attempts = _boxes.size() <= max_refined_boxes ? 8 : 0;
+    auto& order = best_order;
+    offsets = _offsets;
+    int64_t top = min_required;
+    for (int attempt = 0; attempt < max_attempts; attempt++) {
+        std::stable_partition(order.begin(), order.end(), [&](const Box* box) {
+            return box->size != 0 && offsets[box->id] + box->size == top;
+        });
+        top = placeBoxes(order, duration, best_fit, offsets);
+        if (top < min_required) {
+            min_required = top;
+            _offsets = offsets;
+            if (min_required <= lower_bound) break;
+        }
     }
 
-    return _min_required;
+    return min_required;
 }
 
 int64_t MemorySolver::maxDepth() {
@@ -69,6 +69,10 @@ public:
 
     /**
      * @brief Solve memory location with maximal reuse.
+     *
+     * Several greedy placements (different box orders, first-fit and best-fit gap selection)
+     * are tried and the most compact one is kept. Search stops as soon as maxDepth() is reached
+     * because it is a lower bound for any solution.
      * @return Size of common memory blob required for storing all
      */
     int64_t solve();
@@ -141,6 +141,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "ScaledDotProductAttention", ScaledDotProductAttention},
+        { "LayerNorm", LayerNorm},
 };
 
 Type TypeFromName(const std::string type) {
@@ -759,7 +761,10 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         };
 
         MKLDNNMemoryPtr ptr;
-        if (weightCache != nullptr) {
+        if (i < packedWeights.size() && packedWeights[i] &&
+                MKLDNNMemoryDesc(packedWeights[i]->GetDescriptor()) == intDescs[i]) {
+            ptr = packedWeights[i];
+        } else if (weightCache != nullptr) {
             const uint64_t data_hash = weightCache->GetHashFunc().hash(
                     internalBlob->buffer(), internalBlob->byteSize());
 
@@ -774,6 +779,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         internalBlobMemory.push_back(ptr);
     }
+    packedWeights = internalBlobMemory;
 }
 
 bool MKLDNNNode::isInplace() const {
@@ -83,7 +83,9 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    ScaledDotProductAttention,
+    LayerNorm
 };
 
 Type TypeFromName(const std::string type);
@@ -198,6 +200,10 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
+        case LayerNorm:
+            return "LayerNorm";
         default:
             return "Unknown";
     }
@@ -567,6 +573,9 @@ protected:
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
+    // internal blobs reordered into the layouts of the selected primitive. Set by the graph before primitives
+    // are created to reuse weights packed by an exported network, prepareMemory stores the ones it has made.
+    std::vector<MKLDNNMemoryPtr> packedWeights;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
@@ -7,9 +7,12 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <algorithm>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
@@ -33,6 +36,8 @@
 
 #include <transformations/common_optimizations/common_optimizations.hpp>
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
+#include <transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp>
+#include <transformations/common_optimizations/layer_norm_fusion.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
 #include <transformations/op_conversions/convert_gelu.hpp>
@@ -59,6 +64,7 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -191,6 +197,61 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
                 return true;
             });
 
+    // Unidirectional sequences with full-length sequences and constant weights are executed by a single
+    // MKLDNNRNN primitive (via SequenceIE) instead of a TensorIterator running one cell per time step
+    auto isSequencePrimitiveSupported = [](const_node_ptr &node) -> bool {
+        const auto &rnn_base = std::dynamic_pointer_cast<const ngraph::op::util::RNNCellBase>(node);
+        if (!rnn_base)
+            return false;
+
+        ngraph::op::RecurrentSequenceDirection direction;
+        size_t seq_lengths_port = 2;
+        bool activations_supported = false;
+        const auto &activations = rnn_base->get_activations();
+        if (const auto &rnn_seq = std::dynamic_pointer_cast<const ngraph::opset5::RNNSequence>(node)) {
+            direction = rnn_seq->get_direction();
+            activations_supported = activations.size() == 1 &&
+                    (activations[0] == "sigmoid" || activations[0] == "tanh" || activations[0] == "relu");
+        } else if (const auto &gru_seq = std::dynamic_pointer_cast<const ngraph::opset5::GRUSequence>(node)) {
+            direction = gru_seq->get_direction();
+            activations_supported = activations == std::vector<std::string>{"sigmoid", "tanh"};
+        } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ngraph::opset5::LSTMSequence>(node)) {
+            direction = lstm_seq->get_direction();
+            seq_lengths_port = 3;
+            activations_supported = activations == std::vector<std::string>{"sigmoid", "tanh", "tanh"};
+        } else {
+            return false;
+        }
+
+        if (!activations_supported || direction == ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL ||
+            rnn_base->get_clip() != 0.0f || !rnn_base->get_activations_alpha().empty() ||
+            !rnn_base->get_activations_beta().empty())
+            return false;
+
+        // W, R and B follow seq_lengths
+        for (size_t port = seq_lengths_port + 1; port < node->get_input_size(); port++) {
+            if (!ngraph::is_type<ngraph::opset5::Constant>(node->get_input_node_ptr(port)))
+                return false;
+        }
+
+        // SequenceIE ignores seq_lengths, so all sequences must span the whole time axis
+        const auto &seq_lengths = std::dynamic_pointer_cast<const ngraph::opset5::Constant>(
+                node->get_input_node_shared_ptr(seq_lengths_port));
+        if (!seq_lengths)
+            return false;
+        const auto max_seq_len = static_cast<int64_t>(node->get_input_shape(0).at(1));
+        const auto &seq_lengths_values = seq_lengths->cast_vector<int64_t>();
+        return std::all_of(seq_lengths_values.begin(), seq_lengths_values.end(),
+                           [max_seq_len](int64_t value) { return value == max_seq_len; });
+    };
+
+    pass_config->set_callback<ngraph::pass::ConvertRNNSequenceToTensorIterator,
+                              ngraph::pass::ConvertGRUSequenceToTensorIterator,
+                              ngraph::pass::ConvertLSTMSequenceToTensorIterator>(
+            [isSequencePrimitiveSupported](const_node_ptr &node) -> bool {
+                return isSequencePrimitiveSupported(node);
+            });
+
     // List of enabled/disabled transformations
     pass_config->disable<ngraph::pass::ConvertGELU>();
     pass_config->disable<ngraph::pass::HSwishDecomposition>();
@@ -202,6 +263,8 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
     pass_config->disable<ngraph::pass::LogSoftmaxDecomposition>();
 
     pass_config->enable<ngraph::pass::ConvertPadToGroupConvolution>();
+    pass_config->enable<ngraph::pass::ScaledDotProductAttentionFusion>();
+    pass_config->enable<ngraph::pass::LayerNormFusion>();
 
     manager.run_passes(nGraphFunc);
 
@@ -252,6 +315,8 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
 
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "Transformation", "convertFunctionToICNNNetwork");
 
+    // MKLDNN nodes and graph optimizations are implemented on top of CNNLayer, so the graph is still built
+    // from the legacy representation. Constants are shared with the function, only the layer objects are new.
     clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
 
     OV_ITT_TASK_NEXT(taskChain, "ConvertIOPrecision");
@@ -263,6 +328,43 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
     }
 }
 
+static details::CNNNetworkImplPtr ConvertNetwork(ICNNNetwork::Ptr& clonedNetwork, const Config& conf) {
+    bool is_transformed = false;
+    if (clonedNetwork->getFunction()) {
+        Transformation(clonedNetwork, conf);
+        is_transformed = true;
+    }
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
+    if (implNetwork) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!is_transformed) {
+            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+        }
+    }
+    return implNetwork;
+}
+
+static MKLDNNExecNetwork::NetworkConverter MakeNetworkConverter(const Config& conf) {
+    return [conf] (const ICNNNetwork& network, const ICNNNetwork::InputShapes& shapes) {
+        auto reshapedNetwork = cloneNetwork(network);
+        ResponseDesc resp;
+        if (reshapedNetwork->reshape(shapes, &resp) != OK)
+            THROW_IE_EXCEPTION << "Failed to reshape network for shape cache: " << resp.msg;
+        auto implNetwork = ConvertNetwork(reshapedNetwork, conf);
+        if (!implNetwork)
+            THROW_IE_EXCEPTION << "Failed to convert reshaped network for shape cache";
+        return implNetwork;
+    };
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -296,30 +398,69 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    if (conf.shapeCacheSize > 0) {
+        if (!network.getFunction())
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Shape cache is supported only for networks created from ngraph::Function";
+        if (conf.enableDynamicBatch)
+            THROW_IE_EXCEPTION << "Shape cache cannot be used together with dynamic batch";
+    }
+
     std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
+    details::CNNNetworkImplPtr implNetwork;
+    std::shared_ptr<ICNNNetwork> reshapableNetwork;
+    MKLDNNExecNetwork::NetworkConverter networkConverter;
+    if (conf.shapeCacheSize > 0) {
+        // the conversion transforms a network in place, so the clone is kept as is for other shapes and the network
+        // is converted from its copy the same way as for other shapes (constants are shared by the copies)
+        reshapableNetwork = clonedNetwork;
+        networkConverter = MakeNetworkConverter(conf);
+        implNetwork = networkConverter(*reshapableNetwork, network.getInputShapes());
+    } else {
+        implNetwork = ConvertNetwork(clonedNetwork, conf);
+    }
 
-    bool is_transformed = false;
-    if (clonedNetwork->getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
+    // the converted network is not referenced by anyone else, so the executable network takes it as is
+    auto execNetwork = implNetwork ?
+        std::make_shared<MKLDNNExecNetwork>(implNetwork, conf, extensionManager, weightsSharing) :
+        std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    execNetwork->setLoadConfig(config);
+
+    if (reshapableNetwork) {
+        execNetwork->setNetworkConverter(reshapableNetwork, networkConverter);
     }
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
-        }
+    return execNetwork;
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    auto imported = DeserializeNetwork(networkModel, *GetCore());
+    for (auto&& entry : config) {
+        imported.config[entry.first] = entry.second;
+    }
+
+    Config conf = engConfig;
+    conf.readProperties(imported.config);
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(imported.network->getBatchSize());
+    }
+
+    // the network is already transformed, graphs are compiled from it taking the exported decisions
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(imported.network, conf, extensionManager, weightsSharing,
+                                                           imported.compiledInfo);
+    execNetwork->setLoadConfig(imported.config);
+    if (imported.reshapableNetwork) {
+        execNetwork->setNetworkConverter(imported.reshapableNetwork, MakeNetworkConverter(conf));
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    execNetwork->setNetworkInputs(imported.inputs);
+    execNetwork->setNetworkOutputs(imported.outputs);
+    execNetwork->SetPointerToPlugin(shared_from_this());
+    return ExecutableNetwork(make_executable_network(execNetwork));
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -362,6 +503,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -408,6 +550,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <istream>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -25,6 +26,10 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork
+    ImportNetworkImpl(std::istream& networkModel,
+                      const std::map<std::string, std::string>& config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -0,0 +1,755 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <cpp_interfaces/exception2status.hpp>
+#include <ie_blob.h>
+#include <blob_factory.hpp>
+#include <ie_system_conf.h>
+#include <legacy/ie_layers.h>
+#include <legacy/layer_transform.hpp>
+#include <legacy/net_pass.h>
+#include <pugixml.hpp>
+#include <xml_parse_utils.h>
+#include <transformations/serialize.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+void checkStream(const std::istream& stream) {
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: unexpected end of stream";
+    }
+}
+
+template <typename T>
+void write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T read(std::istream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    checkStream(stream);
+    return value;
+}
+
+void writeSizedString(std::ostream& stream, const std::string& str) {
+    write<std::uint64_t>(stream, str.size());
+    stream.write(str.data(), str.size());
+}
+
+std::string readSizedString(std::istream& stream) {
+    auto size = read<std::uint64_t>(stream);
+    std::string str(static_cast<std::size_t>(size), '\0');
+    stream.read(&str[0], size);
+    checkStream(stream);
+    return str;
+}
+
+void writeSizes(std::ostream& stream, const SizeVector& sizes) {
+    write<std::uint64_t>(stream, sizes.size());
+    for (auto size : sizes) {
+        write<std::uint64_t>(stream, size);
+    }
+}
+
+SizeVector readSizes(std::istream& stream) {
+    SizeVector sizes(static_cast<std::size_t>(read<std::uint64_t>(stream)));
+    for (auto& size : sizes) {
+        size = static_cast<std::size_t>(read<std::uint64_t>(stream));
+    }
+    return sizes;
+}
+
+void writeTensorDesc(std::ostream& stream, const TensorDesc& desc) {
+    write<std::int32_t>(stream, desc.getPrecision());
+    write<std::int32_t>(stream, desc.getLayout());
+    writeSizes(stream, desc.getDims());
+    const auto& blockingDesc = desc.getBlockingDesc();
+    writeSizes(stream, blockingDesc.getBlockDims());
+    writeSizes(stream, blockingDesc.getOrder());
+    write<std::uint64_t>(stream, blockingDesc.getOffsetPadding());
+    writeSizes(stream, blockingDesc.getOffsetPaddingToData());
+    writeSizes(stream, blockingDesc.getStrides());
+}
+
+TensorDesc readTensorDesc(std::istream& stream) {
+    Precision precision(static_cast<Precision::ePrecision>(read<std::int32_t>(stream)));
+    auto layout = static_cast<Layout>(read<std::int32_t>(stream));
+    auto dims = readSizes(stream);
+    auto blockDims = readSizes(stream);
+    auto order = readSizes(stream);
+    auto offsetPadding = static_cast<std::size_t>(read<std::uint64_t>(stream));
+    auto offsetPaddingToData = readSizes(stream);
+    auto strides = readSizes(stream);
+    if (layout == Layout::BLOCKED) {
+        return TensorDesc(precision, dims, BlockingDesc(blockDims, order, offsetPadding, offsetPaddingToData, strides));
+    }
+    return TensorDesc(precision, dims, layout);
+}
+
+IE_SUPPRESS_DEPRECATED_START
+
+// The exact class of a layer is restored on import, so its typed fields are parsed from params the same way
+// the conversion from ngraph::Function does. The class is identified by its index in details::AllLayers.
+struct LayerClass {
+    std::type_index type;
+    CNNLayerPtr (*create)(const LayerParams&);
+};
+
+template <std::size_t I = 0, typename... Tp>
+inline typename std::enable_if<I == sizeof...(Tp), void>::type addLayerClasses(std::vector<LayerClass>&,
+                                                                              const std::tuple<Tp...>&) {}
+
+template <std::size_t I = 0, typename... Tp>
+inline typename std::enable_if<I < sizeof...(Tp), void>::type addLayerClasses(std::vector<LayerClass>& classes,
+                                                                             const std::tuple<Tp...>& t) {
+    using EType = typename std::remove_pointer<typename std::tuple_element<I, std::tuple<Tp...>>::type>::type;
+    classes.push_back({std::type_index(typeid(EType)), [](const LayerParams& params) -> CNNLayerPtr {
+        return std::make_shared<EType>(params);
+    }});
+    addLayerClasses<I + 1, Tp...>(classes, t);
+}
+
+const std::vector<LayerClass>& layerClasses() {
+    static const std::vector<LayerClass> classes = [] {
+        std::vector<LayerClass> allClasses;
+        addLayerClasses(allClasses, details::AllLayers());
+        return allClasses;
+    }();
+    return classes;
+}
+
+/**
+ * @brief Writes layers and data of a network or a TensorIterator body, blobs shared by several layers are written once
+ */
+class NetworkWriter {
+public:
+    explicit NetworkWriter(std::ostream& stream) : _stream(stream) {}
+
+    // returns indices the data of the scope are written with
+    std::unordered_map<const Data*, std::int64_t> writeScope(const std::vector<CNNLayerPtr>& layers,
+                                                             const std::vector<DataPtr>& inputs) {
+        std::unordered_map<const CNNLayer*, std::int64_t> layerIndices;
+        for (auto&& layer : layers) {
+            layerIndices.emplace(layer.get(), layerIndices.size());
+        }
+
+        std::vector<DataPtr> data;
+        std::unordered_map<const Data*, std::int64_t> dataIndices;
+        auto addData = [&](const DataPtr& d) {
+            if (d && dataIndices.emplace(d.get(), data.size()).second) {
+                data.push_back(d);
+            }
+        };
+        for (auto&& input : inputs) {
+            addData(input);
+        }
+        for (auto&& layer : layers) {
+            for (auto&& outData : layer->outData) {
+                addData(outData);
+            }
+        }
+
+        write<std::uint64_t>(_stream, layers.size());
+        for (auto&& layer : layers) {
+            write<std::uint32_t>(_stream, layerClass(*layer));
+            writeSizedString(_stream, layer->name);
+            writeSizedString(_stream, layer->type);
+            write<std::int32_t>(_stream, layer->precision);
+            writeSizedString(_stream, layer->affinity);
+            write<std::uint64_t>(_stream, layer->params.size());
+            for (auto&& param : layer->params) {
+                writeSizedString(_stream, param.first);
+                writeSizedString(_stream, param.second);
+            }
+            write<std::uint64_t>(_stream, layer->blobs.size());
+            for (auto&& blob : layer->blobs) {
+                writeSizedString(_stream, blob.first);
+                writeBlob(blob.second);
+            }
+        }
+
+        write<std::uint64_t>(_stream, data.size());
+        for (auto&& d : data) {
+            writeSizedString(_stream, d->getName());
+            writeTensorDesc(_stream, d->getTensorDesc());
+            auto creator = layerIndices.find(getCreatorLayer(d).lock().get());
+            write<std::int64_t>(_stream, creator != layerIndices.end() ? creator->second : -1);
+            std::vector<std::int64_t> consumers;
+            for (auto&& inputTo : getInputTo(d)) {
+                auto consumer = layerIndices.find(inputTo.second.get());
+                if (consumer != layerIndices.end()) {
+                    consumers.push_back(consumer->second);
+                }
+            }
+            writeIndices(consumers);
+        }
+
+        auto indicesOf = [&](const std::vector<DataPtr>& dataVector) {
+            std::vector<std::int64_t> indices;
+            for (auto&& d : dataVector) {
+                auto found = dataIndices.find(d.get());
+                if (found == dataIndices.end()) {
+                    THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Data " << (d ? d->getName() : std::string{})
+                                       << " is out of the exported scope";
+                }
+                indices.push_back(found->second);
+            }
+            return indices;
+        };
+
+        for (auto&& layer : layers) {
+            std::vector<DataPtr> insData;
+            for (auto&& inData : layer->insData) {
+                insData.push_back(inData.lock());
+            }
+            writeIndices(indicesOf(insData));
+            writeIndices(indicesOf(layer->outData));
+
+            if (auto ti = std::dynamic_pointer_cast<TensorIterator>(layer)) {
+                for (auto portMap : {&ti->input_port_map, &ti->output_port_map, &ti->back_edges}) {
+                    write<std::uint64_t>(_stream, portMap->size());
+                    for (auto&& rule : *portMap) {
+                        write(_stream, rule);
+                    }
+                }
+                auto bodyIndices = writeScope(NetPass::TIBodySortTopologically(ti->body), ti->body.inputs);
+                for (auto bodyData : {&ti->body.inputs, &ti->body.outputs}) {
+                    std::vector<std::int64_t> indices;
+                    for (auto&& d : *bodyData) {
+                        auto found = bodyIndices.find(d.get());
+                        indices.push_back(found != bodyIndices.end() ? found->second : -1);
+                    }
+                    writeIndices(indices);
+                }
+            }
+        }
+        return dataIndices;
+    }
+
+private:
+    static std::uint32_t layerClass(const CNNLayer& layer) {
+        const auto& classes = layerClasses();
+        auto found = std::find_if(classes.begin(), classes.end(), [&](const LayerClass& layerClass) {
+            return layerClass.type == std::type_index(typeid(layer));
+        });
+        if (found == classes.end()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of layer " << layer.name << " of class "
+                               << typeid(layer).name() << " is not supported";
+        }
+        return static_cast<std::uint32_t>(found - classes.begin());
+    }
+
+    void writeIndices(const std::vector<std::int64_t>& indices) {
+        write<std::uint64_t>(_stream, indices.size());
+        for (auto index : indices) {
+            write<std::int64_t>(_stream, index);
+        }
+    }
+
+    void writeBlob(const Blob::Ptr& blob) {
+        auto found = _blobIndices.find(blob.get());
+        if (found != _blobIndices.end()) {
+            write<std::uint64_t>(_stream, found->second);
+            return;
+        }
+        auto index = _blobIndices.size();
+        _blobIndices.emplace(blob.get(), index);
+        write<std::uint64_t>(_stream, index);
+        write<std::uint8_t>(_stream, blob != nullptr);
+        if (blob == nullptr) {
+            return;
+        }
+        writeTensorDesc(_stream, blob->getTensorDesc());
+        auto mem = blob->cbuffer();
+        write<std::uint8_t>(_stream, mem.as<const char*>() != nullptr);
+        if (mem.as<const char*>() != nullptr) {
+            write<std::uint64_t>(_stream, blob->byteSize());
+            _stream.write(mem.as<const char*>(), blob->byteSize());
+        }
+    }
+
+    std::ostream& _stream;
+    std::unordered_map<const Blob*, std::uint64_t> _blobIndices;
+};
+
+/**
+ * @brief Reads layers and data written by NetworkWriter, links them together and parses typed fields of layers
+ */
+class NetworkReader {
+public:
+    struct Scope {
+        std::vector<CNNLayerPtr> layers;
+        std::vector<DataPtr> data;
+    };
+
+    explicit NetworkReader(std::istream& stream) : _stream(stream) {}
+
+    Scope readScope() {
+        Scope scope;
+        scope.layers.resize(static_cast<std::size_t>(read<std::uint64_t>(_stream)));
+        for (auto& layer : scope.layers) {
+            const auto& layerClass = at(layerClasses(), read<std::uint32_t>(_stream));
+            LayerParams params;
+            params.name = readSizedString(_stream);
+            params.type = readSizedString(_stream);
+            params.precision = Precision(static_cast<Precision::ePrecision>(read<std::int32_t>(_stream)));
+            layer = layerClass.create(params);
+            layer->affinity = readSizedString(_stream);
+            for (auto paramsCount = read<std::uint64_t>(_stream); paramsCount > 0; paramsCount--) {
+                auto key = readSizedString(_stream);
+                layer->params[key] = readSizedString(_stream);
+            }
+            for (auto blobsCount = read<std::uint64_t>(_stream); blobsCount > 0; blobsCount--) {
+                auto key = readSizedString(_stream);
+                layer->blobs[key] = readBlob();
+            }
+            if (auto weightable = std::dynamic_pointer_cast<WeightableLayer>(layer)) {
+                weightable->_weights = layer->blobs["weights"];
+                weightable->_biases = layer->blobs["biases"];
+                if (!weightable->_weights) layer->blobs.erase("weights");
+                if (!weightable->_biases) layer->blobs.erase("biases");
+            }
+        }
+
+        scope.data.resize(static_cast<std::size_t>(read<std::uint64_t>(_stream)));
+        for (auto& d : scope.data) {
+            auto name = readSizedString(_stream);
+            d = std::make_shared<Data>(name, readTensorDesc(_stream));
+            auto creator = read<std::int64_t>(_stream);
+            if (creator >= 0) {
+                getCreatorLayer(d) = at(scope.layers, creator);
+            }
+            for (auto index : readIndices()) {
+                auto consumer = at(scope.layers, index);
+                getInputTo(d)[consumer->name] = consumer;
+            }
+        }
+
+        for (auto& layer : scope.layers) {
+            for (auto index : readIndices()) {
+                layer->insData.push_back(at(scope.data, index));
+            }
+            for (auto index : readIndices()) {
+                layer->outData.push_back(at(scope.data, index));
+            }
+
+            if (auto ti = std::dynamic_pointer_cast<TensorIterator>(layer)) {
+                for (auto portMap : {&ti->input_port_map, &ti->output_port_map, &ti->back_edges}) {
+                    portMap->resize(static_cast<std::size_t>(read<std::uint64_t>(_stream)));
+                    for (auto& rule : *portMap) {
+                        rule = read<TensorIterator::PortMap>(_stream);
+                    }
+                }
+                auto body = readScope();
+                for (auto bodyData : {&ti->body.inputs, &ti->body.outputs}) {
+                    for (auto index : readIndices()) {
+                        bodyData->push_back(index >= 0 ? at(body.data, index) : nullptr);
+                    }
+                }
+            }
+        }
+
+        for (auto& layer : scope.layers) {
+            layer->parseParams();
+        }
+        return scope;
+    }
+
+private:
+    template <typename T>
+    static const T& at(const std::vector<T>& items, std::int64_t index) {
+        if (index < 0 || static_cast<std::size_t>(index) >= items.size()) {
+            THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: index " << index << " is out of range";
+        }
+        return items[static_cast<std::size_t>(index)];
+    }
+
+    std::vector<std::int64_t> readIndices() {
+        std::vector<std::int64_t> indices(static_cast<std::size_t>(read<std::uint64_t>(_stream)));
+        for (auto& index : indices) {
+            index = read<std::int64_t>(_stream);
+        }
+        return indices;
+    }
+
+    Blob::Ptr readBlob() {
+        auto index = read<std::uint64_t>(_stream);
+        if (index < _blobs.size()) {
+            return _blobs[static_cast<std::size_t>(index)];
+        }
+        if (index != _blobs.size()) {
+            THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: blob " << index << " is out of order";
+        }
+        Blob::Ptr blob;
+        if (read<std::uint8_t>(_stream)) {
+            blob = make_blob_with_precision(readTensorDesc(_stream));
+            if (read<std::uint8_t>(_stream)) {
+                auto byteSize = read<std::uint64_t>(_stream);
+                blob->allocate();
+                if (byteSize != blob->byteSize()) {
+                    THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: blob size mismatch";
+                }
+                _stream.read(blob->buffer().as<char*>(), byteSize);
+                checkStream(_stream);
+            }
+        }
+        _blobs.push_back(blob);
+        return blob;
+    }
+
+    std::istream& _stream;
+    std::vector<Blob::Ptr> _blobs;
+};
+
+IE_SUPPRESS_DEPRECATED_END
+
+void writeCompiledInfo(std::ostream& stream, const CompiledGraphInfo& compiledInfo) {
+    write<std::uint64_t>(stream, compiledInfo.nodes.size());
+    for (auto&& node : compiledInfo.nodes) {
+        writeSizedString(stream, node.first);
+        write<std::int32_t>(stream, node.second.selectedDescriptor);
+        write<std::int32_t>(stream, node.second.implType);
+        write<std::uint64_t>(stream, node.second.packedWeights.size());
+        for (auto&& weights : node.second.packedWeights) {
+            write<std::uint8_t>(stream, weights != nullptr);
+            if (weights != nullptr) {
+                write(stream, weights->GetDescriptor().data);
+                auto size = weights->GetPrimitiveDescriptor().get_size();
+                write<std::uint64_t>(stream, size);
+                stream.write(static_cast<const char*>(weights->GetData()), size);
+            }
+        }
+    }
+}
+
+std::shared_ptr<CompiledGraphInfo> readCompiledInfo(std::istream& stream) {
+    auto compiledInfo = std::make_shared<CompiledGraphInfo>();
+    for (auto nodesCount = read<std::uint64_t>(stream); nodesCount > 0; nodesCount--) {
+        auto& node = compiledInfo->nodes[readSizedString(stream)];
+        node.selectedDescriptor = read<std::int32_t>(stream);
+        node.implType = static_cast<impl_desc_type>(read<std::int32_t>(stream));
+        node.packedWeights.resize(static_cast<std::size_t>(read<std::uint64_t>(stream)));
+        for (auto& weights : node.packedWeights) {
+            if (!read<std::uint8_t>(stream)) {
+                continue;
+            }
+            auto desc = read<mkldnn_memory_desc_t>(stream);
+            auto size = read<std::uint64_t>(stream);
+            weights = std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+            weights->Create(mkldnn::memory::desc(desc));
+            if (weights->GetPrimitiveDescriptor().get_size() != size) {
+                THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: packed weights size mismatch";
+            }
+            stream.read(static_cast<char*>(weights->GetData()), size);
+            checkStream(stream);
+        }
+    }
+    return compiledInfo;
+}
+
+std::string joinDims(const SizeVector& dims) {
+    std::stringstream str;
+    for (size_t i = 0; i < dims.size(); i++) {
+        str << (i ? "," : "") << dims[i];
+    }
+    return str.str();
+}
+
+SizeVector splitDims(const std::string& str) {
+    SizeVector dims;
+    std::stringstream stream(str);
+    std::string dim;
+    while (std::getline(stream, dim, ',')) {
+        dims.push_back(static_cast<size_t>(std::stoull(dim)));
+    }
+    return dims;
+}
+
+}  // namespace
+
+void SerializeNetwork(std::ostream& stream,
+                      const CNNNetworkImpl& network,
+                      const CompiledGraphInfo& compiledInfo,
+                      const ICNNNetwork::Ptr& reshapableNetwork,
+                      const InputsDataMap& inputs,
+                      const OutputsDataMap& outputs,
+                      const std::map<std::string, std::string>& config) {
+    std::shared_ptr<const ngraph::Function> reshapableFunction;
+    if (reshapableNetwork) {
+        reshapableFunction = static_cast<const ICNNNetwork&>(*reshapableNetwork).getFunction();
+        if (!reshapableFunction) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of a network with shape cache requires ngraph::Function";
+        }
+    }
+
+    std::vector<Blob::Ptr> meanImages;
+
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    // the network is transformed to bfloat16 on the machines which support it only
+    cpuNode.append_attribute("bf16").set_value(with_cpu_x86_bfloat16());
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : inputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+        inputNode.append_attribute("dims").set_value(joinDims(networkInput.second->getTensorDesc().getDims()).c_str());
+
+        const auto& preProcess = networkInput.second->getPreProcess();
+        auto preProcessNode = inputNode.append_child("preprocess");
+        preProcessNode.append_attribute("resize").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        preProcessNode.append_attribute("color").set_value(static_cast<int>(preProcess.getColorFormat()));
+        preProcessNode.append_attribute("mean-variant").set_value(static_cast<int>(preProcess.getMeanVariant()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            const auto& channel = preProcess[c];
+            auto channelNode = preProcessNode.append_child("channel");
+            channelNode.append_attribute("scale").set_value(channel->stdScale);
+            channelNode.append_attribute("mean").set_value(channel->meanValue);
+            if (channel->meanData) {
+                const auto& dims = channel->meanData->getTensorDesc().getDims();
+                channelNode.append_attribute("mean-height").set_value(static_cast<unsigned long long>(dims[0]));
+                channelNode.append_attribute("mean-width").set_value(static_cast<unsigned long long>(dims[1]));
+                meanImages.push_back(channel->meanData);
+            }
+        }
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : outputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+        outputNode.append_attribute("dims").set_value(joinDims(networkOutput.second->getTensorDesc().getDims()).c_str());
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    for (auto&& entry : config) {
+        auto configNode = configsNode.append_child("config");
+        configNode.append_attribute("key").set_value(entry.first.c_str());
+        configNode.append_attribute("value").set_value(entry.second.c_str());
+    }
+
+    doc.save(stream, nullptr, pugi::format_raw);
+    stream << std::endl;
+
+    // the network graphs are compiled from, all transformations are already applied to it
+    std::vector<CNNLayerPtr> layers;
+    for (auto&& layer : network.allLayers()) {
+        layers.push_back(layer.second);
+    }
+    NetworkWriter writer(stream);
+    auto dataIndices = writer.writeScope(layers, {});
+    writeSizedString(stream, network.getName());
+
+    InputsDataMap networkInputs;
+    network.getInputsInfo(networkInputs);
+    write<std::uint64_t>(stream, networkInputs.size());
+    for (auto&& input : networkInputs) {
+        writeSizedString(stream, input.first);
+        write<std::int64_t>(stream, dataIndices.at(input.second->getInputData().get()));
+    }
+    OutputsDataMap networkOutputs;
+    network.getOutputsInfo(networkOutputs);
+    write<std::uint64_t>(stream, networkOutputs.size());
+    for (auto&& output : networkOutputs) {
+        write<std::int64_t>(stream, dataIndices.at(output.second.get()));
+    }
+
+    writeCompiledInfo(stream, compiledInfo);
+
+    write<std::uint8_t>(stream, reshapableFunction != nullptr);
+    if (reshapableFunction) {
+        std::stringstream xmlFile, binFile;
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::Serialize>(xmlFile, binFile);
+        manager.run_passes(std::const_pointer_cast<ngraph::Function>(reshapableFunction));
+
+        writeSizedString(stream, xmlFile.str());
+        writeSizedString(stream, binFile.str());
+    }
+
+    for (auto&& meanImage : meanImages) {
+        auto mem = meanImage->cbuffer();
+        stream.write(mem.as<const char*>(), meanImage->byteSize());
+    }
+}
+
+DeserializedNetwork DeserializeNetwork(std::istream& stream, ICore& core) {
+    std::string cpuXmlStr;
+    std::getline(stream, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load_string(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+    if (cpuNode.attribute("bf16").as_bool() != with_cpu_x86_bfloat16()) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: it was compiled for another CPU";
+    }
+
+    DeserializedNetwork result;
+
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+            configNode = configNode.next_sibling("config")) {
+        result.config[GetStrAttr(configNode, "key")] = GetStrAttr(configNode, "value");
+    }
+
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto inputName = GetStrAttr(inputNode, "name");
+        auto input = std::make_shared<InputInfo>();
+        input->setInputData(std::make_shared<Data>(inputName,
+            TensorDesc(Precision::FromStr(GetStrAttr(inputNode, "precision")),
+                       splitDims(GetStrAttr(inputNode, "dims", "")),
+                       static_cast<Layout>(GetIntAttr(inputNode, "layout")))));
+
+        auto preProcessNode = inputNode.child("preprocess");
+        auto& preProcess = input->getPreProcess();
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(preProcessNode, "resize")));
+        preProcess.setColorFormat(static_cast<ColorFormat>(GetIntAttr(preProcessNode, "color")));
+
+        size_t numberOfChannels = 0;
+        for (auto channelNode = preProcessNode.child("channel"); !channelNode.empty();
+                channelNode = channelNode.next_sibling("channel")) {
+            numberOfChannels++;
+        }
+        if (numberOfChannels != 0) {
+            preProcess.init(numberOfChannels);
+        }
+
+        size_t c = 0;
+        for (auto channelNode = preProcessNode.child("channel"); !channelNode.empty();
+                channelNode = channelNode.next_sibling("channel"), c++) {
+            preProcess[c]->stdScale = GetFloatAttr(channelNode, "scale");
+            preProcess[c]->meanValue = GetFloatAttr(channelNode, "mean");
+            if (channelNode.attribute("mean-height")) {
+                SizeVector dims = {static_cast<size_t>(GetUInt64Attr(channelNode, "mean-height")),
+                                   static_cast<size_t>(GetUInt64Attr(channelNode, "mean-width"))};
+                auto meanImage = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, Layout::HW));
+                meanImage->allocate();
+                preProcess[c]->meanData = meanImage;
+            }
+        }
+        preProcess.setVariant(static_cast<MeanVariant>(GetIntAttr(preProcessNode, "mean-variant")));
+        result.inputs[inputName] = input;
+    }
+
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto outputName = GetStrAttr(outputNode, "name");
+        result.outputs[outputName] = std::make_shared<Data>(outputName,
+            TensorDesc(Precision::FromStr(GetStrAttr(outputNode, "precision")),
+                       splitDims(GetStrAttr(outputNode, "dims", "")),
+                       static_cast<Layout>(GetIntAttr(outputNode, "layout"))));
+    }
+
+    NetworkReader reader(stream);
+    auto scope = reader.readScope();
+    result.network = std::make_shared<CNNNetworkImpl>();
+    result.network->setName(readSizedString(stream));
+    for (auto&& d : scope.data) {
+        result.network->addData(d->getName().c_str(), d);
+    }
+    IE_SUPPRESS_DEPRECATED_START
+    for (auto&& layer : scope.layers) {
+        result.network->addLayer(layer);
+    }
+    IE_SUPPRESS_DEPRECATED_END
+    for (auto inputsCount = read<std::uint64_t>(stream); inputsCount > 0; inputsCount--) {
+        auto inputName = readSizedString(stream);
+        auto input = std::make_shared<InputInfo>();
+        input->setInputData(scope.data.at(static_cast<std::size_t>(read<std::int64_t>(stream))));
+        auto userInput = result.inputs.find(inputName);
+        if (userInput != result.inputs.end()) {
+            input->getPreProcess() = userInput->second->getPreProcess();
+        }
+        result.network->setInputInfo(input);
+    }
+    for (auto outputsCount = read<std::uint64_t>(stream); outputsCount > 0; outputsCount--) {
+        result.network->addOutput(scope.data.at(static_cast<std::size_t>(read<std::int64_t>(stream)))->getName());
+    }
+
+    result.compiledInfo = readCompiledInfo(stream);
+
+    if (read<std::uint8_t>(stream)) {
+        auto xmlString = readSizedString(stream);
+        std::uint64_t dataSize = read<std::uint64_t>(stream);
+
+        Blob::Ptr dataBlob;
+        if (0 != dataSize) {
+            dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8,
+                                                                 {static_cast<std::size_t>(dataSize)},
+                                                                 Layout::C));
+            dataBlob->allocate();
+            stream.read(dataBlob->buffer(), dataSize);
+        }
+
+        auto network = core.ReadNetwork(xmlString, std::move(dataBlob));
+        for (auto&& input : network.getInputsInfo()) {
+            auto userInput = result.inputs.find(input.first);
+            if (userInput == result.inputs.end()) {
+                THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: input " << input.first
+                                   << " was not found";
+            }
+            input.second->setPrecision(userInput->second->getPrecision());
+            input.second->setLayout(userInput->second->getLayout());
+            input.second->getPreProcess() = userInput->second->getPreProcess();
+        }
+        for (auto&& output : network.getOutputsInfo()) {
+            auto userOutput = result.outputs.find(output.first);
+            if (userOutput == result.outputs.end()) {
+                THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: output " << output.first
+                                   << " was not found";
+            }
+            output.second->setPrecision(userOutput->second->getPrecision());
+            output.second->setLayout(userOutput->second->getLayout());
+        }
+        result.reshapableNetwork = network;
+    }
+
+    // mean images follow the network in the order of inputs and channels listed in the header,
+    // the networks share the blobs with the inputs info
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        const auto& preProcess = result.inputs[GetStrAttr(inputNode, "name")]->getPreProcess();
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            if (auto meanImage = preProcess[c]->meanData) {
+                auto mem = meanImage->buffer();
+                stream.read(mem.as<char*>(), meanImage->byteSize());
+            }
+        }
+    }
+
+    checkStream(stream);
+
+    return result;
+}
+
+}  // namespace MKLDNNPlugin
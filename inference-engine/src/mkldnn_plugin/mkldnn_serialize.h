@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_icore.hpp>
+#include <legacy/cnn_network_impl.hpp>
+
+#include "mkldnn_graph.h"
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief An executable network read back by DeserializeNetwork
+ */
+struct DeserializedNetwork {
+    InferenceEngine::details::CNNNetworkImplPtr network;     //!< The network graphs are compiled from
+    std::shared_ptr<const CompiledGraphInfo> compiledInfo;   //!< Decisions taken by the exported graph compilation
+    InferenceEngine::InputsDataMap inputs;                   //!< Inputs info as it was set by a user
+    InferenceEngine::OutputsDataMap outputs;                 //!< Outputs info as it was set by a user
+    InferenceEngine::ICNNNetwork::Ptr reshapableNetwork;     //!< The loaded network if it was loaded with shape cache
+    std::map<std::string, std::string> config;               //!< Config the network was loaded with
+};
+
+/**
+ * @brief Writes an executable network in the CPU plugin export format: a raw XML header line with inputs/outputs info
+ * and load-time config, then the network graphs are compiled from (after all transformations) with its weights,
+ * the compiled graph info (selected primitive descriptors and packed weights), size-prefixed IR v10 of the loaded
+ * network if it is kept for the shape cache and mean images in the order they are listed in the header.
+ * @param reshapableNetwork The loaded network kept for the shape cache, may be nullptr
+ */
+void SerializeNetwork(std::ostream& stream,
+                      const InferenceEngine::details::CNNNetworkImpl& network,
+                      const CompiledGraphInfo& compiledInfo,
+                      const InferenceEngine::ICNNNetwork::Ptr& reshapableNetwork,
+                      const InferenceEngine::InputsDataMap& inputs,
+                      const InferenceEngine::OutputsDataMap& outputs,
+                      const std::map<std::string, std::string>& config);
+
+/**
+ * @brief Reads a network written by SerializeNetwork back
+ */
+DeserializedNetwork DeserializeNetwork(std::istream& stream, InferenceEngine::ICore& core);
+
+}  // namespace MKLDNNPlugin
@@ -21,28 +21,18 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Fast non-cryptographic hash of weights data used to build weights cache keys.
+ * Data is processed in 4 independent 64-bit lanes (xxHash64 scheme); buffers larger
+ * than one chunk are hashed chunk by chunk in parallel and chunk hashes are combined,
+ * so the result does not depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static const size_t kChunkSize = 1 << 20;
 };
 
 /**
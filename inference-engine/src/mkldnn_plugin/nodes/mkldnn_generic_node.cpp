@@ -96,6 +96,7 @@ bool MKLDNNGenericNode::created(const MKLDNNExtensionManager::Ptr &extMgr) {
             auto impl = extMgr->CreateImplementation(getCnnLayer()->getNode());
             if (auto execImpl = std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impl))
                 impls.emplace_back(execImpl);
+            operationImplementation = !impls.empty();
         }
         if (impls.empty()) {
             extFactory = extMgr->CreateExtensionFactory(getCnnLayer());
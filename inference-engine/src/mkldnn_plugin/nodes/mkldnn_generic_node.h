@@ -34,12 +34,21 @@ public:
     void execLayer();
     void cleanup() override;
 
+    /**
+     * @brief Whether the node is executed by an implementation of an ngraph operation provided by an extension,
+     * such a node cannot be created again from its layer without the operation
+     */
+    bool isOperationImplementation() const {
+        return operationImplementation;
+    }
+
 
 protected:
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+    bool operationImplementation = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,400 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layer_norm_node.h"
+#include <legacy/ie_layers.h>
+#include <mkldnn.hpp>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "utils/bfloat16.hpp"
+#include "ie_parallel.hpp"
+
+#include "jit_generator.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_layer_norm_call_args, field)
+
+namespace {
+
+inline const float* rowToFloat(const float* src, float*, size_t) {
+    return src;
+}
+
+inline const float* rowToFloat(const bfloat16_t* src, float* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        buffer[i] = static_cast<float>(src[i]);
+    return buffer;
+}
+
+inline float* rowDestination(float* dst, float*) {
+    return dst;
+}
+
+inline float* rowDestination(bfloat16_t*, float* buffer) {
+    return buffer;
+}
+
+inline void rowFromFloat(const float*, float*, size_t) {}
+
+inline void rowFromFloat(const float* buffer, bfloat16_t* dst, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        dst[i] = static_cast<bfloat16_t>(buffer[i]);
+}
+
+}  // namespace
+
+// src[work_amount] -> sum(src - shift), sum((src - shift)^2), the shift is read from mean
+template <cpu_isa_t isa>
+struct jit_uni_layer_norm_statistics_kernel_f32 : public jit_uni_layer_norm_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_layer_norm_statistics_kernel_f32)
+
+    jit_uni_layer_norm_statistics_kernel_f32() : jit_uni_layer_norm_kernel(), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(mean)]);
+        uni_vbroadcastss(vmm_shift, ptr[reg_tmp]);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+        uni_vpxor(vmm_sum_sq, vmm_sum_sq, vmm_sum_sq);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            uni_vsubps(vmm_val, vmm_val, vmm_shift);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            // uni_vfmadd231ps overrides its second operand on sse42, the value is not used afterwards
+            uni_vfmadd231ps(vmm_sum_sq, vmm_val, vmm_val);
+
+            add(reg_src, vlen);
+            sub(reg_work_amount, simd_w);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF(sum)]);
+        reduce_store(vmm_sum, reg_tmp);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(sum_sq)]);
+        reduce_store(vmm_sum_sq, reg_tmp);
+
+        this->postamble();
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_tmp = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_shift = Vmm(1);
+    Vmm vmm_sum = Vmm(2);
+    Vmm vmm_sum_sq = Vmm(3);
+    Xbyak::Xmm xmm_aux1 = Xbyak::Xmm(4);
+    Xbyak::Xmm xmm_aux2 = Xbyak::Xmm(5);
+    Xbyak::Xmm xmm_aux3 = Xbyak::Xmm(6);
+
+    inline void reduce_store(Vmm vmm, const Xbyak::Reg64& reg_dst) {
+        if (isa == cpu::sse42) {
+            hsum_store(Xbyak::Xmm(vmm.getIdx()), reg_dst);
+        } else if (isa == cpu::avx2) {
+            Xbyak::Ymm ymm = Xbyak::Ymm(vmm.getIdx());
+            vextractf128(xmm_aux1, ymm, 0);
+            vextractf128(xmm_aux2, ymm, 1);
+            addps(xmm_aux1, xmm_aux2);
+            hsum_store(xmm_aux1, reg_dst);
+        } else {
+            Xbyak::Zmm zmm = Xbyak::Zmm(vmm.getIdx());
+            vextractf32x4(xmm_aux1, zmm, 0);
+            vextractf32x4(xmm_aux2, zmm, 1);
+            addps(xmm_aux1, xmm_aux2);
+            vextractf32x4(xmm_aux2, zmm, 2);
+            vextractf32x4(xmm_aux3, zmm, 3);
+            addps(xmm_aux2, xmm_aux3);
+            addps(xmm_aux1, xmm_aux2);
+            hsum_store(xmm_aux1, reg_dst);
+        }
+    }
+
+    inline void hsum_store(Xbyak::Xmm xmm_sum, const Xbyak::Reg64& reg_dst) {
+        movshdup(xmm_aux3, xmm_sum);  //  sum:1,2,3,4; aux3:2,2,4,4
+        addps(xmm_sum, xmm_aux3);     //  sum:1+2,2+2,3+4,4+4
+        movhlps(xmm_aux3, xmm_sum);   //  aux3:3+4,4+4,4,4
+        addps(xmm_sum, xmm_aux3);     //  sum:1+2+3+4,...
+        movss(ptr[reg_dst], xmm_sum);
+    }
+};
+
+// dst[work_amount] = (src - mean) * rstd * gamma + beta, src and dst may alias
+template <cpu_isa_t isa>
+struct jit_uni_layer_norm_kernel_f32 : public jit_uni_layer_norm_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_layer_norm_kernel_f32)
+
+    jit_uni_layer_norm_kernel_f32() : jit_uni_layer_norm_kernel(), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_gamma, ptr[reg_params + GET_OFF(gamma)]);
+        mov(reg_beta, ptr[reg_params + GET_OFF(beta)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(mean)]);
+        uni_vbroadcastss(vmm_mean, ptr[reg_tmp]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(rstd)]);
+        uni_vbroadcastss(vmm_rstd, ptr[reg_tmp]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            uni_vmovups(vmm_gamma, ptr[reg_gamma]);
+            uni_vmovups(vmm_beta, ptr[reg_beta]);
+            uni_vsubps(vmm_val, vmm_val, vmm_mean);
+            uni_vmulps(vmm_val, vmm_val, vmm_rstd);
+            uni_vfmadd231ps(vmm_beta, vmm_val, vmm_gamma);
+            uni_vmovups(ptr[reg_dst], vmm_beta);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            add(reg_gamma, vlen);
+            add(reg_beta, vlen);
+            sub(reg_work_amount, simd_w);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        this->postamble();
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_gamma = r10;
+    Xbyak::Reg64 reg_beta = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_tmp = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_mean = Vmm(1);
+    Vmm vmm_rstd = Vmm(2);
+    Vmm vmm_gamma = Vmm(3);
+    Vmm vmm_beta = Vmm(4);
+};
+
+MKLDNNLayerNormNode::MKLDNNLayerNormNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                         MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNLayerNormNode::getSupportedDescriptors() {
+    auto layer = getCnnLayer();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get CNN layer for layer name " << getName();
+
+    if (getParentEdges().size() != 3)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    eps = layer->GetParamAsFloat("eps");
+
+    auto dataDims = getParentEdgeAt(0)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+    if (dataDims.ndims() < 1 || dataDims != outDims)
+        THROW_IE_EXCEPTION << "Incorrect input and output dims for layer " << getName();
+
+    channels = dataDims[dataDims.ndims() - 1];
+    rows = channels == 0 ? 0 : dataDims.size() / channels;
+    for (size_t i = 1; i < 3; i++) {
+        if (static_cast<size_t>(getParentEdgeAt(i)->getDims().size()) != channels)
+            THROW_IE_EXCEPTION << "Scale and shift sizes do not match the normalized dimension for layer " << getName();
+    }
+}
+
+void MKLDNNLayerNormNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    inputPrecision = getCnnLayer()->insData[0].lock()->getPrecision() == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    outputPrecision = getCnnLayer()->outData[0]->getPrecision() == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+
+    auto createDataConfig = [](const MKLDNNDims& dims, memory::data_type dataType) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(0)->getDims(), inputDataType));
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(1)->getDims(), memory::f32));
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(2)->getDims(), memory::f32));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), outputDataType));
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::sse42)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
+    supportedPrimitiveDescriptors.push_back({config, impl_type, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
+}
+
+void MKLDNNLayerNormNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    size_t simdWidth = 0;
+    if (mayiuse(cpu::avx512_common)) {
+        statisticsKernel.reset(new jit_uni_layer_norm_statistics_kernel_f32<cpu::avx512_common>());
+        normalizeKernel.reset(new jit_uni_layer_norm_kernel_f32<cpu::avx512_common>());
+        simdWidth = 16;
+    } else if (mayiuse(cpu::avx2)) {
+        statisticsKernel.reset(new jit_uni_layer_norm_statistics_kernel_f32<cpu::avx2>());
+        normalizeKernel.reset(new jit_uni_layer_norm_kernel_f32<cpu::avx2>());
+        simdWidth = 8;
+    } else if (mayiuse(cpu::sse42)) {
+        statisticsKernel.reset(new jit_uni_layer_norm_statistics_kernel_f32<cpu::sse42>());
+        normalizeKernel.reset(new jit_uni_layer_norm_kernel_f32<cpu::sse42>());
+        simdWidth = 4;
+    }
+    vectorChannels = simdWidth == 0 ? 0 : channels / simdWidth * simdWidth;
+
+    // bf16 rows are converted to fp32 and normalized in place
+    if (inputPrecision != Precision::FP32 || outputPrecision != Precision::FP32)
+        scratch.resize(channels * parallel_get_max_threads());
+}
+
+void MKLDNNLayerNormNode::normalizeRow(const float* src, const float* gamma, const float* beta, float* dst) const {
+    // the row is shifted by its first value to keep the variance accurate when the mean is large
+    const float shift = src[0];
+    float sum = 0.f;
+    float sumSq = 0.f;
+
+    jit_layer_norm_call_args args;
+    args.src = src;
+    args.dst = dst;
+    args.gamma = gamma;
+    args.beta = beta;
+    args.mean = &shift;
+    args.sum = &sum;
+    args.sum_sq = &sumSq;
+    args.work_amount = vectorChannels;
+    if (vectorChannels != 0)
+        (*statisticsKernel)(&args);
+    for (size_t c = vectorChannels; c < channels; c++) {
+        const float value = src[c] - shift;
+        sum += value;
+        sumSq += value * value;
+    }
+
+    const float shiftedMean = sum / channels;
+    const float variance = std::max(sumSq / channels - shiftedMean * shiftedMean, 0.f);
+    const float mean = shift + shiftedMean;
+    const float rstd = 1.f / std::sqrt(variance + eps);
+
+    args.mean = &mean;
+    args.rstd = &rstd;
+    if (vectorChannels != 0)
+        (*normalizeKernel)(&args);
+    for (size_t c = vectorChannels; c < channels; c++)
+        dst[c] = (src[c] - mean) * rstd * gamma[c] + beta[c];
+}
+
+template <typename in_data_t, typename out_data_t>
+void MKLDNNLayerNormNode::normalize(const in_data_t* src, const float* gamma, const float* beta, out_data_t* dst) {
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float* buffer = scratch.empty() ? nullptr : &scratch[ithr * channels];
+
+        for_1d(ithr, nthr, rows, [&](size_t r) {
+            const float* srcRow = rowToFloat(src + r * channels, buffer, channels);
+            float* dstRow = rowDestination(dst + r * channels, buffer);
+            normalizeRow(srcRow, gamma, beta, dstRow);
+            rowFromFloat(dstRow, dst + r * channels, channels);
+        });
+    });
+}
+
+void MKLDNNLayerNormNode::execute(mkldnn::stream strm) {
+    if (rows == 0)
+        return;
+
+    auto src = getParentEdgeAt(0)->getMemoryPtr()->GetData();
+    auto gamma = reinterpret_cast<const float*>(getParentEdgeAt(1)->getMemoryPtr()->GetData());
+    auto beta = reinterpret_cast<const float*>(getParentEdgeAt(2)->getMemoryPtr()->GetData());
+    auto dst = getChildEdgeAt(0)->getMemoryPtr()->GetData();
+
+    if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32) {
+        normalize(reinterpret_cast<const float*>(src), gamma, beta, reinterpret_cast<float*>(dst));
+    } else if (inputPrecision == Precision::FP32 && outputPrecision == Precision::BF16) {
+        normalize(reinterpret_cast<const float*>(src), gamma, beta, reinterpret_cast<bfloat16_t*>(dst));
+    } else if (inputPrecision == Precision::BF16 && outputPrecision == Precision::FP32) {
+        normalize(reinterpret_cast<const bfloat16_t*>(src), gamma, beta, reinterpret_cast<float*>(dst));
+    } else if (inputPrecision == Precision::BF16 && outputPrecision == Precision::BF16) {
+        normalize(reinterpret_cast<const bfloat16_t*>(src), gamma, beta, reinterpret_cast<bfloat16_t*>(dst));
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported precisions for layer " << getName();
+    }
+}
+
+bool MKLDNNLayerNormNode::created() const {
+    return getType() == LayerNorm;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNLayerNormNode, LayerNorm);
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_layer_norm_call_args {
+    const float *src;
+    float *dst;
+    const float *gamma;
+    const float *beta;
+    const float *mean;  // the shift of the row in the statistics kernel
+    const float *rstd;
+    float *sum;
+    float *sum_sq;
+    size_t work_amount;
+};
+
+struct jit_uni_layer_norm_kernel {
+    void (*ker_)(const jit_layer_norm_call_args *);
+
+    void operator()(const jit_layer_norm_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_layer_norm_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_layer_norm_kernel() {}
+};
+
+/**
+ * Normalizes each row of the innermost dimension as (x - mean) / sqrt(variance + eps) * gamma + beta.
+ * The sum and the sum of squares are gathered in a single sweep, so a row is read twice instead of the three
+ * times MVN needs, and the scale and shift are applied while the normalized values are stored.
+ */
+class MKLDNNLayerNormNode : public MKLDNNNode {
+public:
+    MKLDNNLayerNormNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNLayerNormNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    bool created() const override;
+    void execute(mkldnn::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    template <typename in_data_t, typename out_data_t>
+    void normalize(const in_data_t* src, const float* gamma, const float* beta, out_data_t* dst);
+
+    void normalizeRow(const float* src, const float* gamma, const float* beta, float* dst) const;
+
+    float eps = 0.f;
+    size_t rows = 0;
+    size_t channels = 0;
+    // the number of channels handled by the kernels, the rest is processed by the reference code
+    size_t vectorChannels = 0;
+    std::vector<float> scratch;
+
+    InferenceEngine::Precision inputPrecision, outputPrecision;
+
+    std::shared_ptr<jit_uni_layer_norm_kernel> statisticsKernel;
+    std::shared_ptr<jit_uni_layer_norm_kernel> normalizeKernel;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,585 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_scaled_dot_product_attention_node.h"
+#include <legacy/ie_layers.h>
+#include <mkldnn.hpp>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "utils/bfloat16.hpp"
+#include "ie_parallel.hpp"
+
+#include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_sdpa_call_args, field)
+
+namespace {
+
+// the vector registers holding the accumulators and the loaded rows in the scores and values kernels
+constexpr int sdpa_unroll = 4;
+
+}  // namespace
+
+// query[D], key[D][key_block] -> scores[key_block], work_amount = D
+template <cpu_isa_t isa>
+struct jit_uni_sdpa_scores_kernel_f32 : public jit_uni_sdpa_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sdpa_scores_kernel_f32)
+
+    explicit jit_uni_sdpa_scores_kernel_f32(jit_sdpa_config_params jcp) : jit_uni_sdpa_kernel(jcp), jit_generator() {
+        this->preamble();
+
+        mov(reg_scores, ptr[reg_params + GET_OFF(scores)]);
+
+        const int vecs = jcp_.key_block / simd_w;
+        for (int v0 = 0; v0 < vecs; v0 += sdpa_unroll) {
+            const int ur = std::min(sdpa_unroll, vecs - v0);
+
+            mov(reg_query, ptr[reg_params + GET_OFF(query)]);
+            mov(reg_key, ptr[reg_params + GET_OFF(key)]);
+            mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+            for (int u = 0; u < ur; u++)
+                uni_vpxor(Vmm(u), Vmm(u), Vmm(u));
+
+            Xbyak::Label loop_label;
+            Xbyak::Label loop_end_label;
+
+            L(loop_label);
+            {
+                cmp(reg_work_amount, 0);
+                jle(loop_end_label, T_NEAR);
+
+                uni_vbroadcastss(vmm_query, ptr[reg_query]);
+                for (int u = 0; u < ur; u++) {
+                    // uni_vfmadd231ps overrides its second operand on sse42, so the key is loaded every time
+                    uni_vmovups(Vmm(sdpa_unroll + u), ptr[reg_key + (v0 + u) * vlen]);
+                    uni_vfmadd231ps(Vmm(u), Vmm(sdpa_unroll + u), vmm_query);
+                }
+
+                add(reg_query, sizeof(float));
+                add(reg_key, jcp_.key_block * sizeof(float));
+                sub(reg_work_amount, 1);
+
+                jmp(loop_label, T_NEAR);
+            }
+            L(loop_end_label);
+
+            for (int u = 0; u < ur; u++)
+                uni_vmovups(ptr[reg_scores + (v0 + u) * vlen], Vmm(u));
+        }
+
+        this->postamble();
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_query = r8;
+    Xbyak::Reg64 reg_key = r9;
+    Xbyak::Reg64 reg_scores = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_query = Vmm(2 * sdpa_unroll);
+};
+
+// scores[key_block] -> exp(scores - max) in place, sum of the exponents
+template <cpu_isa_t isa>
+struct jit_uni_sdpa_exp_kernel_f32 : public jit_uni_sdpa_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sdpa_exp_kernel_f32)
+
+    explicit jit_uni_sdpa_exp_kernel_f32(jit_sdpa_config_params jcp) : jit_uni_sdpa_kernel(jcp), jit_generator() {
+        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, alg_kind::eltwise_exp, 0.f, 0.f));
+
+        this->preamble();
+
+        mov(reg_scores, ptr[reg_params + GET_OFF(scores)]);
+        mov(reg_max, ptr[reg_params + GET_OFF(max)]);
+        mov(reg_sum, ptr[reg_params + GET_OFF(sum)]);
+
+        uni_vbroadcastss(vmm_max, ptr[reg_max]);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+        const int vecs = jcp_.key_block / simd_w;
+        for (int v0 = 0; v0 < vecs; v0 += sdpa_unroll) {
+            const int ur = std::min(sdpa_unroll, vecs - v0);
+            // Xmm(0) is used by the injector as a mask on sse42
+            for (int u = 0; u < ur; u++) {
+                uni_vmovups(Vmm(1 + u), ptr[reg_scores + (v0 + u) * vlen]);
+                uni_vsubps(Vmm(1 + u), Vmm(1 + u), vmm_max);
+            }
+
+            exp_injector->compute_vector_range(1, 1 + ur);
+
+            for (int u = 0; u < ur; u++) {
+                uni_vmovups(ptr[reg_scores + (v0 + u) * vlen], Vmm(1 + u));
+                uni_vaddps(vmm_sum, vmm_sum, Vmm(1 + u));
+            }
+        }
+
+        // hsum+store
+        if (isa == cpu::sse42) {
+            hsum_store(Xbyak::Xmm(vmm_sum.getIdx()));
+        } else if (isa == cpu::avx2) {
+            Xbyak::Ymm ymm_sum = Xbyak::Ymm(vmm_sum.getIdx());
+            vextractf128(xmm_aux1, ymm_sum, 0);
+            vextractf128(xmm_aux2, ymm_sum, 1);
+            addps(xmm_aux1, xmm_aux2);
+            hsum_store(xmm_aux1);
+        } else {
+            Xbyak::Zmm zmm_sum = Xbyak::Zmm(vmm_sum.getIdx());
+            vextractf32x4(xmm_aux1, zmm_sum, 0);
+            vextractf32x4(xmm_aux2, zmm_sum, 1);
+            addps(xmm_aux1, xmm_aux2);
+            vextractf32x4(xmm_aux2, zmm_sum, 2);
+            vextractf32x4(xmm_aux3, zmm_sum, 3);
+            addps(xmm_aux2, xmm_aux3);
+            addps(xmm_aux1, xmm_aux2);
+            hsum_store(xmm_aux1);
+        }
+
+        this->postamble();
+
+        exp_injector->prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_scores = r8;
+    Xbyak::Reg64 reg_max = r9;
+    Xbyak::Reg64 reg_sum = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_max = Vmm(14);
+    Vmm vmm_sum = Vmm(15);
+    Xbyak::Xmm xmm_aux1 = Xbyak::Xmm(5);
+    Xbyak::Xmm xmm_aux2 = Xbyak::Xmm(6);
+    Xbyak::Xmm xmm_aux3 = Xbyak::Xmm(7);
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    inline void hsum_store(Xbyak::Xmm xmm_sum) {
+        movshdup(xmm_aux3, xmm_sum);  //  sum:1,2,3,4; aux3:2,2,4,4
+        addps(xmm_sum, xmm_aux3);     //  sum:1+2,2+2,3+4,4+4
+        movhlps(xmm_aux3, xmm_sum);   //  aux3:3+4,4+4,4,4
+        addps(xmm_sum, xmm_aux3);     //  sum:1+2+3+4,...
+        movss(ptr[reg_sum], xmm_sum);
+    }
+};
+
+// acc[value_stride] = acc * correction + sum_j scores[j] * value[j][value_stride], work_amount = number of keys
+template <cpu_isa_t isa>
+struct jit_uni_sdpa_values_kernel_f32 : public jit_uni_sdpa_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sdpa_values_kernel_f32)
+
+    explicit jit_uni_sdpa_values_kernel_f32(jit_sdpa_config_params jcp) : jit_uni_sdpa_kernel(jcp), jit_generator() {
+        this->preamble();
+
+        mov(reg_acc, ptr[reg_params + GET_OFF(acc)]);
+        mov(reg_correction, ptr[reg_params + GET_OFF(correction)]);
+        uni_vbroadcastss(vmm_correction, ptr[reg_correction]);
+
+        const int vecs = jcp_.value_stride / simd_w;
+        for (int v0 = 0; v0 < vecs; v0 += sdpa_unroll) {
+            const int ur = std::min(sdpa_unroll, vecs - v0);
+
+            for (int u = 0; u < ur; u++) {
+                uni_vmovups(Vmm(u), ptr[reg_acc + (v0 + u) * vlen]);
+                uni_vmulps(Vmm(u), Vmm(u), vmm_correction);
+            }
+
+            mov(reg_scores, ptr[reg_params + GET_OFF(scores)]);
+            mov(reg_value, ptr[reg_params + GET_OFF(value)]);
+            mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+            Xbyak::Label loop_label;
+            Xbyak::Label loop_end_label;
+
+            L(loop_label);
+            {
+                cmp(reg_work_amount, 0);
+                jle(loop_end_label, T_NEAR);
+
+                uni_vbroadcastss(vmm_score, ptr[reg_scores]);
+                for (int u = 0; u < ur; u++) {
+                    uni_vmovups(Vmm(sdpa_unroll + u), ptr[reg_value + (v0 + u) * vlen]);
+                    uni_vfmadd231ps(Vmm(u), Vmm(sdpa_unroll + u), vmm_score);
+                }
+
+                add(reg_scores, sizeof(float));
+                add(reg_value, jcp_.value_stride * sizeof(float));
+                sub(reg_work_amount, 1);
+
+                jmp(loop_label, T_NEAR);
+            }
+            L(loop_end_label);
+
+            for (int u = 0; u < ur; u++)
+                uni_vmovups(ptr[reg_acc + (v0 + u) * vlen], Vmm(u));
+        }
+
+        this->postamble();
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_scores = r8;
+    Xbyak::Reg64 reg_value = r9;
+    Xbyak::Reg64 reg_acc = r10;
+    Xbyak::Reg64 reg_correction = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_score = Vmm(2 * sdpa_unroll);
+    Vmm vmm_correction = Vmm(2 * sdpa_unroll + 1);
+};
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const InferenceEngine::CNNLayerPtr& layer,
+                                                                         const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNScaledDotProductAttentionNode::getSupportedDescriptors() {
+    auto layer = getCnnLayer();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get CNN layer for layer name " << getName();
+
+    if (getParentEdges().size() != 3 && getParentEdges().size() != 4)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    scale = layer->GetParamAsFloat("scale", 1.f);
+    keyTransposed = layer->GetParamAsBool("key_transposed", false);
+    hasMask = getParentEdges().size() == 4;
+
+    auto queryDims = getParentEdgeAt(0)->getDims();
+    auto keyDims = getParentEdgeAt(1)->getDims();
+    auto valueDims = getParentEdgeAt(2)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    const int nDims = queryDims.ndims();
+    if (nDims < 2 || keyDims.ndims() != nDims || valueDims.ndims() != nDims || outDims.ndims() != nDims)
+        THROW_IE_EXCEPTION << "Unsupported input dims count for layer " << getName();
+
+    batch = 1;
+    for (int i = 0; i < nDims - 2; i++) {
+        if (keyDims[i] != queryDims[i] || valueDims[i] != queryDims[i] || outDims[i] != queryDims[i])
+            THROW_IE_EXCEPTION << "Input batch dimensions are incorrect for layer " << getName();
+        batch *= queryDims[i];
+    }
+
+    queryLength = queryDims[nDims - 2];
+    headSize = queryDims[nDims - 1];
+    keyLength = keyTransposed ? keyDims[nDims - 1] : keyDims[nDims - 2];
+    valueSize = valueDims[nDims - 1];
+    const size_t keyDepth = keyTransposed ? keyDims[nDims - 2] : keyDims[nDims - 1];
+    if (keyDepth != headSize || static_cast<size_t>(valueDims[nDims - 2]) != keyLength ||
+        static_cast<size_t>(outDims[nDims - 2]) != queryLength || static_cast<size_t>(outDims[nDims - 1]) != valueSize)
+        THROW_IE_EXCEPTION << "Spatial input and output dimensions are incorrect for layer " << getName();
+
+    maskOffsets.assign(batch, 0);
+    maskQueryStride = maskKeyStride = 0;
+    if (hasMask) {
+        auto maskDims = getParentEdgeAt(3)->getDims().ToSizeVector();
+        if (maskDims.size() > static_cast<size_t>(nDims))
+            THROW_IE_EXCEPTION << "Unsupported mask dims count for layer " << getName();
+        maskDims.insert(maskDims.begin(), nDims - maskDims.size(), 1);
+
+        SizeVector scoresDims = queryDims.ToSizeVector();
+        scoresDims[nDims - 1] = keyLength;
+        SizeVector maskStrides(nDims, 0);
+        size_t stride = 1;
+        for (int i = nDims - 1; i >= 0; i--) {
+            if (maskDims[i] != scoresDims[i] && maskDims[i] != 1)
+                THROW_IE_EXCEPTION << "Mask dimensions are incorrect for layer " << getName();
+            maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+            stride *= maskDims[i];
+        }
+        maskQueryStride = maskStrides[nDims - 2];
+        maskKeyStride = maskStrides[nDims - 1];
+
+        for (size_t b = 0; b < batch; b++) {
+            size_t rest = b;
+            for (int i = nDims - 3; i >= 0; i--) {
+                maskOffsets[b] += (rest % scoresDims[i]) * maskStrides[i];
+                rest /= scoresDims[i];
+            }
+        }
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    inputPrecision = Precision::FP32;
+    for (size_t i = 0; i < 3; i++) {
+        if (getCnnLayer()->insData[i].lock()->getPrecision() == Precision::BF16)
+            inputPrecision = Precision::BF16;
+    }
+    outputPrecision = getCnnLayer()->outData[0]->getPrecision() == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+
+    auto createDataConfig = [](const MKLDNNDims& dims, memory::data_type dataType) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    for (size_t i = 0; i < 3; i++)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(i)->getDims(), inputDataType));
+    if (hasMask)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(3)->getDims(), memory::f32));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), outputDataType));
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::sse42)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
+    supportedPrimitiveDescriptors.push_back({config, impl_type, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
+}
+
+void MKLDNNScaledDotProductAttentionNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    // a block of queries and a tile of keys and values are kept in L2 while the block is processed
+    const size_t simdWidth = 16;
+    queryBlock = 32;
+    keyBlock = 64;
+    valueStride = rnd_up(valueSize, simdWidth);
+
+    jit_sdpa_config_params jcp;
+    jcp.key_block = static_cast<int>(keyBlock);
+    jcp.value_stride = static_cast<int>(valueStride);
+
+    if (mayiuse(cpu::avx512_common)) {
+        scoresKernel.reset(new jit_uni_sdpa_scores_kernel_f32<cpu::avx512_common>(jcp));
+        expKernel.reset(new jit_uni_sdpa_exp_kernel_f32<cpu::avx512_common>(jcp));
+        valuesKernel.reset(new jit_uni_sdpa_values_kernel_f32<cpu::avx512_common>(jcp));
+    } else if (mayiuse(cpu::avx2)) {
+        scoresKernel.reset(new jit_uni_sdpa_scores_kernel_f32<cpu::avx2>(jcp));
+        expKernel.reset(new jit_uni_sdpa_exp_kernel_f32<cpu::avx2>(jcp));
+        valuesKernel.reset(new jit_uni_sdpa_values_kernel_f32<cpu::avx2>(jcp));
+    } else if (mayiuse(cpu::sse42)) {
+        scoresKernel.reset(new jit_uni_sdpa_scores_kernel_f32<cpu::sse42>(jcp));
+        expKernel.reset(new jit_uni_sdpa_exp_kernel_f32<cpu::sse42>(jcp));
+        valuesKernel.reset(new jit_uni_sdpa_values_kernel_f32<cpu::sse42>(jcp));
+    }
+
+    // queries, keys, values, scores, accumulators, running maximums and sums of a thread
+    threadScratchSize = queryBlock * headSize + headSize * keyBlock + keyBlock * valueStride + keyBlock +
+                        queryBlock * valueStride + 2 * queryBlock;
+    scratch.resize(threadScratchSize * parallel_get_max_threads());
+}
+
+void MKLDNNScaledDotProductAttentionNode::computeScores(jit_sdpa_call_args& args) const {
+    if (scoresKernel) {
+        (*scoresKernel)(&args);
+        return;
+    }
+    for (size_t j = 0; j < keyBlock; j++) {
+        float score = 0.f;
+        for (size_t d = 0; d < args.work_amount; d++)
+            score += args.query[d] * args.key[d * keyBlock + j];
+        args.scores[j] = score;
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::computeExp(jit_sdpa_call_args& args) const {
+    if (expKernel) {
+        (*expKernel)(&args);
+        return;
+    }
+    float sum = 0.f;
+    for (size_t j = 0; j < keyBlock; j++) {
+        args.scores[j] = std::exp(args.scores[j] - *args.max);
+        sum += args.scores[j];
+    }
+    *args.sum = sum;
+}
+
+void MKLDNNScaledDotProductAttentionNode::accumulateValues(jit_sdpa_call_args& args) const {
+    if (valuesKernel) {
+        (*valuesKernel)(&args);
+        return;
+    }
+    for (size_t c = 0; c < valueStride; c++)
+        args.acc[c] *= *args.correction;
+    for (size_t j = 0; j < args.work_amount; j++) {
+        for (size_t c = 0; c < valueStride; c++)
+            args.acc[c] += args.scores[j] * args.value[j * valueStride + c];
+    }
+}
+
+template <typename in_data_t, typename out_data_t>
+void MKLDNNScaledDotProductAttentionNode::attention(const in_data_t* query, const in_data_t* key, const in_data_t* value,
+                                                    const float* mask, out_data_t* dst) {
+    const size_t queryBlocks = div_up(queryLength, queryBlock);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float* queryTile = &scratch[ithr * threadScratchSize];
+        float* keyTile = queryTile + queryBlock * headSize;
+        float* valueTile = keyTile + headSize * keyBlock;
+        float* scores = valueTile + keyBlock * valueStride;
+        float* acc = scores + keyBlock;
+        float* rowMax = acc + queryBlock * valueStride;
+        float* rowSum = rowMax + queryBlock;
+
+        for_2d(ithr, nthr, batch, queryBlocks, [&](size_t b, size_t qb) {
+            const size_t q0 = qb * queryBlock;
+            const size_t rows = std::min(queryBlock, queryLength - q0);
+
+            const in_data_t* q = query + (b * queryLength + q0) * headSize;
+            for (size_t i = 0; i < rows * headSize; i++)
+                queryTile[i] = static_cast<float>(q[i]) * scale;
+            std::fill(acc, acc + rows * valueStride, 0.f);
+            std::fill(rowMax, rowMax + rows, -std::numeric_limits<float>::infinity());
+            std::fill(rowSum, rowSum + rows, 0.f);
+
+            const in_data_t* k = key + b * keyLength * headSize;
+            const in_data_t* v = value + b * keyLength * valueSize;
+            for (size_t k0 = 0; k0 < keyLength; k0 += keyBlock) {
+                const size_t keys = std::min(keyBlock, keyLength - k0);
+
+                // keys are packed as [headSize][keyBlock], so the scores of a query are computed along the vectors
+                for (size_t d = 0; d < headSize; d++) {
+                    for (size_t j = 0; j < keys; j++)
+                        keyTile[d * keyBlock + j] = static_cast<float>(keyTransposed ? k[d * keyLength + k0 + j]
+                                                                                     : k[(k0 + j) * headSize + d]);
+                    std::fill(keyTile + d * keyBlock + keys, keyTile + (d + 1) * keyBlock, 0.f);
+                }
+                for (size_t j = 0; j < keys; j++) {
+                    for (size_t c = 0; c < valueSize; c++)
+                        valueTile[j * valueStride + c] = static_cast<float>(v[(k0 + j) * valueSize + c]);
+                    std::fill(valueTile + j * valueStride + valueSize, valueTile + (j + 1) * valueStride, 0.f);
+                }
+
+                for (size_t i = 0; i < rows; i++) {
+                    jit_sdpa_call_args args;
+                    args.query = queryTile + i * headSize;
+                    args.key = keyTile;
+                    args.value = valueTile;
+                    args.scores = scores;
+                    args.acc = acc + i * valueStride;
+                    args.work_amount = headSize;
+                    computeScores(args);
+
+                    if (hasMask) {
+                        const float* m = mask + maskOffsets[b] + (q0 + i) * maskQueryStride + k0 * maskKeyStride;
+                        for (size_t j = 0; j < keys; j++)
+                            scores[j] += m[j * maskKeyStride];
+                    }
+                    std::fill(scores + keys, scores + keyBlock, std::numeric_limits<float>::lowest());
+
+                    float tileMax = *std::max_element(scores, scores + keys);
+                    float newMax = std::max(rowMax[i], tileMax);
+                    // nothing is attended yet
+                    if (newMax == -std::numeric_limits<float>::infinity())
+                        continue;
+
+                    float tileSum = 0.f;
+                    float correction = std::exp(rowMax[i] - newMax);
+                    args.max = &newMax;
+                    args.sum = &tileSum;
+                    computeExp(args);
+
+                    args.correction = &correction;
+                    args.work_amount = keys;
+                    accumulateValues(args);
+
+                    rowSum[i] = rowSum[i] * correction + tileSum;
+                    rowMax[i] = newMax;
+                }
+            }
+
+            out_data_t* d = dst + (b * queryLength + q0) * valueSize;
+            for (size_t i = 0; i < rows; i++) {
+                const float norm = 1.f / rowSum[i];
+                for (size_t c = 0; c < valueSize; c++)
+                    d[i * valueSize + c] = static_cast<out_data_t>(acc[i * valueStride + c] * norm);
+            }
+        });
+    });
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    auto query = getParentEdgeAt(0)->getMemoryPtr()->GetData();
+    auto key = getParentEdgeAt(1)->getMemoryPtr()->GetData();
+    auto value = getParentEdgeAt(2)->getMemoryPtr()->GetData();
+    auto mask = hasMask ? reinterpret_cast<const float*>(getParentEdgeAt(3)->getMemoryPtr()->GetData()) : nullptr;
+    auto dst = getChildEdgeAt(0)->getMemoryPtr()->GetData();
+
+    if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32) {
+        attention(reinterpret_cast<const float*>(query), reinterpret_cast<const float*>(key),
+                  reinterpret_cast<const float*>(value), mask, reinterpret_cast<float*>(dst));
+    } else if (inputPrecision == Precision::FP32 && outputPrecision == Precision::BF16) {
+        attention(reinterpret_cast<const float*>(query), reinterpret_cast<const float*>(key),
+                  reinterpret_cast<const float*>(value), mask, reinterpret_cast<bfloat16_t*>(dst));
+    } else if (inputPrecision == Precision::BF16 && outputPrecision == Precision::FP32) {
+        attention(reinterpret_cast<const bfloat16_t*>(query), reinterpret_cast<const bfloat16_t*>(key),
+                  reinterpret_cast<const bfloat16_t*>(value), mask, reinterpret_cast<float*>(dst));
+    } else if (inputPrecision == Precision::BF16 && outputPrecision == Precision::BF16) {
+        attention(reinterpret_cast<const bfloat16_t*>(query), reinterpret_cast<const bfloat16_t*>(key),
+                  reinterpret_cast<const bfloat16_t*>(value), mask, reinterpret_cast<bfloat16_t*>(dst));
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported precisions for layer " << getName();
+    }
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention);
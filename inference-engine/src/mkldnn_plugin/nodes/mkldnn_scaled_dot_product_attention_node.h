@@ -0,0 +1,100 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_sdpa_config_params {
+    int key_block;      // number of keys in a tile, multiple of the vector length
+    int value_stride;   // row length of a packed value tile, multiple of the vector length
+};
+
+struct jit_sdpa_call_args {
+    const float *query;
+    const float *key;
+    const float *value;
+    float *scores;
+    float *acc;
+    const float *max;
+    float *sum;
+    const float *correction;
+    size_t work_amount;
+};
+
+struct jit_uni_sdpa_kernel {
+    void (*ker_)(const jit_sdpa_call_args *);
+
+    void operator()(const jit_sdpa_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_sdpa_kernel(jit_sdpa_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_sdpa_kernel() {}
+
+    jit_sdpa_config_params jcp_;
+};
+
+/**
+ * Computes softmax(scale * Q x K^T + mask) x V tile by tile: a block of queries is multiplied by a tile of keys
+ * and the softmax is accumulated online, so the attention matrix is never written to memory.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                        MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNScaledDotProductAttentionNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    bool created() const override;
+    void execute(mkldnn::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    template <typename in_data_t, typename out_data_t>
+    void attention(const in_data_t* query, const in_data_t* key, const in_data_t* value, const float* mask, out_data_t* dst);
+
+    void computeScores(jit_sdpa_call_args& args) const;
+    void computeExp(jit_sdpa_call_args& args) const;
+    void accumulateValues(jit_sdpa_call_args& args) const;
+
+    float scale = 1.f;
+    bool keyTransposed = false;
+    bool hasMask = false;
+
+    size_t batch = 0;
+    size_t queryLength = 0;
+    size_t keyLength = 0;
+    size_t headSize = 0;
+    size_t valueSize = 0;
+    // offsets of the mask for each batch and the mask strides along the queries and the keys, 0 if broadcast
+    std::vector<size_t> maskOffsets;
+    size_t maskQueryStride = 0;
+    size_t maskKeyStride = 0;
+
+    size_t queryBlock = 0;
+    size_t keyBlock = 0;
+    size_t valueStride = 0;
+    size_t threadScratchSize = 0;
+    std::vector<float> scratch;
+
+    InferenceEngine::Precision inputPrecision, outputPrecision;
+
+    std::shared_ptr<jit_uni_sdpa_kernel> scoresKernel;
+    std::shared_ptr<jit_uni_sdpa_kernel> expKernel;
+    std::shared_ptr<jit_uni_sdpa_kernel> valuesKernel;
+};
+
+}  // namespace MKLDNNPlugin
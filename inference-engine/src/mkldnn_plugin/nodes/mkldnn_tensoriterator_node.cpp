@@ -47,10 +47,66 @@ static InferenceEngine::LayerConfig make_plain_config(const InferenceEngine::CNN
     return config;
 }
 
+/**
+ * Consumers which take the address of their inputs at execution, either by binding the edge memory primitive
+ * (its data handle is switched for each slice) or by reading the edge memory in execute(). Other nodes may
+ * keep pointers obtained in createPrimitive (e.g. reorders create memory over the input buffer).
+ */
+static bool readsInputAtExecution(const MKLDNNNodePtr &node) {
+    switch (node->getType()) {
+        case Convolution:
+        case FullyConnected:
+        case Pooling:
+        case SoftMax:
+        case RNNCell:
+        case RNNSeq:
+        case Eltwise:
+        case Gemm:
+        case Generic:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Collects memory of all edges sharing the buffer of a body input (following in-place reshapes).
+ * Returns false if some consumer may write into this buffer or keep its address, so it cannot point
+ * to the outer tensor.
+ */
+static bool collectReadOnlyAliases(const MKLDNNNodePtr &node, void *data, std::vector<MKLDNNMemoryPtr> &aliases) {
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        if (edge->getMemory().GetPrimitive().get_data_handle() != data)
+            continue;
+        aliases.push_back(edge->getMemoryPtr());
+
+        auto child = edge->getChild();
+        if (child->getType() == Reshape) {
+            if (!collectReadOnlyAliases(child, data, aliases))
+                return false;
+            continue;
+        }
+
+        if (child->isConstant() || child->isInplace() || !readsInputAtExecution(child))
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() == data)
+                return false;
+        }
+    }
+    return true;
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
+    /**
+     * If aliases of the destination are provided for a sliced source and each slice is a contiguous block
+     * of the same layout, the destination memory is pointed to the slice instead of copying it.
+     */
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng) {
+                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng,
+                       const std::vector<MKLDNNMemoryPtr> &aliases = {}) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
 
@@ -84,7 +140,16 @@ public:
         chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
         chunk_stride_in_byte *= sign_of_stride;
 
-        if (sliced_src) {
+        bool contiguous_chunk = true;
+        for (int i = 0; i < axis; i++)
+            contiguous_chunk = contiguous_chunk && full_dims[i] == 1;
+
+        if (sliced_src && !aliases.empty() && contiguous_chunk &&
+            from->GetDataType() == to->GetDataType() && from->GetFormat() == to->GetFormat() &&
+            MKLDNNMemory::IsPlainFormat(to->GetFormat())) {
+            for (const auto &alias : aliases)
+                alias_mem.push_back(alias->GetPrimitive());
+        } else if (sliced_src) {
             reorders.emplace_back(chunk_mem_prim, to->GetPrimitive());
         } else {
             reorders.emplace_back(from->GetPrimitive(), chunk_mem_prim);
@@ -97,13 +162,21 @@ public:
         auto full_mem = mem_holder[FULL_DATA];
         auto chunk_mem = mem_holder[CHUNK_DATA];
 
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (!alias_mem.empty()) {
+            for (auto &mem : alias_mem)
+                mem.set_data_handle(chunk_ptr);
+            return;
+        }
 
+        chunk_mem.set_data_handle(chunk_ptr);
         strm.submit({reorders.begin(), reorders.end()});
     }
 
 private:
+    std::vector<mkldnn::memory> alias_mem;
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
 
@@ -203,6 +276,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        input_nodes.push_back(in_node);
     }
 
     // Assume that order of outputs in original TI and produces sub_graph is same
@@ -233,10 +307,15 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+        } else {
+            // Body reads the slice in place unless some of its nodes may write into the input memory
+            std::vector<MKLDNNMemoryPtr> aliases;
+            if (!collectReadOnlyAliases(input_nodes[map_rule.to], to_mem->GetPrimitive().get_data_handle(), aliases))
+                aliases.clear();
+            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng, aliases));
+        }
     }
 
     for (auto map_rule : ti->output_port_map) {
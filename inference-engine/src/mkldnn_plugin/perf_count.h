@@ -4,21 +4,71 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+
+#include "perf_trace.h"
 
 namespace MKLDNNPlugin {
 
 class PerfCount {
+    // Durations are kept in a log-linear histogram: values below 2 * subBuckets have their own bucket,
+    // larger ones are split into subBuckets per power of two, so percentiles are accurate within 12.5%.
+    static constexpr unsigned subBucketBits = 2;
+    static constexpr unsigned subBuckets = 1u << subBucketBits;
+    static constexpr unsigned maxValueBits = 36;
+    static constexpr unsigned histogramSize = (maxValueBits - subBucketBits + 1) * subBuckets;
+
     uint64_t duration;
     uint32_t num;
+    std::array<uint32_t, histogramSize> histogram = {};
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    static unsigned bucketOf(uint64_t value) {
+        if (value < 2 * subBuckets)
+            return static_cast<unsigned>(value);
+        unsigned msb = 0;
+        for (uint64_t v = value; v >>= 1;)
+            msb++;
+        if (msb >= maxValueBits)
+            return histogramSize - 1;
+        return (msb - subBucketBits) * subBuckets + static_cast<unsigned>(value >> (msb - subBucketBits));
+    }
+
+    static uint64_t bucketLowerBound(unsigned bucket) {
+        if (bucket < 2 * subBuckets)
+            return bucket;
+        const unsigned msb = bucket / subBuckets + subBucketBits - 1;
+        return static_cast<uint64_t>(bucket % subBuckets + subBuckets) << (msb - subBucketBits);
+    }
+
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint64_t avg() const { return (num == 0) ? 0 : duration / num; }
+
+    /**
+     * @brief Returns an approximate duration in microseconds not exceeded by the given fraction of iterations
+     * @param fraction A value in [0, 1], e.g. 0.99 for the 99th percentile
+     */
+    uint64_t percentile(double fraction) const {
+        if (num == 0)
+            return 0;
+        const uint64_t rank = static_cast<uint64_t>(fraction * (num - 1)) + 1;
+        uint64_t seen = 0;
+        for (unsigned bucket = 0; bucket < histogramSize; bucket++) {
+            seen += histogram[bucket];
+            if (seen >= rank) {
+                // the middle of the bucket is the best guess of a value within it
+                const uint64_t low = bucketLowerBound(bucket);
+                return low + (bucketLowerBound(bucket + 1) - low) / 2;
+            }
+        }
+        return bucketLowerBound(histogramSize - 1);
+    }
 
 private:
     void start_itr() {
@@ -28,8 +78,10 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        const uint64_t itrDuration = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += itrDuration;
         num++;
+        histogram[bucketOf(itrDuration)]++;
     }
 
     friend class PerfHelper;
@@ -37,13 +89,25 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    PerfTrace *trace;
+    size_t name;
+    int stream;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, PerfTrace *trace = nullptr, size_t name = 0, int stream = 0)
+        : counter(count), trace(trace), name(name), stream(stream) {
+        counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        counter.finish_itr();
+        if (trace != nullptr)
+            trace->record(name, stream, counter.__start, counter.__finish);
+    }
 };
 
 }  // namespace MKLDNNPlugin
 
 #define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF_TRACE(_counter, _trace, _name, _stream) \
+    PerfHelper __helper##__counter (_counter->PerfCounter(), _trace, _name, _stream);
@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_trace.h"
+
+#include <algorithm>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+unsigned currentThreadIndex() {
+    static std::atomic<unsigned> threadsCount{0};
+    static thread_local unsigned index = threadsCount++;
+    return index;
+}
+
+void writeEscaped(std::ostream& stream, const std::string& str) {
+    for (auto c : str) {
+        if (c == '"' || c == '\\')
+            stream << '\\';
+        stream << c;
+    }
+}
+
+}  // namespace
+
+PerfTrace::PerfTrace(size_t capacity) :
+    _capacity(std::max<size_t>(capacity, 1)),
+    _origin(std::chrono::high_resolution_clock::now()),
+    _events(new Event[_capacity]()) {
+}
+
+size_t PerfTrace::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock{_namesMutex};
+    auto inserted = _nameIds.emplace(name, _names.size());
+    if (inserted.second)
+        _names.push_back(name);
+    return inserted.first->second;
+}
+
+void PerfTrace::record(size_t name, int stream, TimePoint start, TimePoint finish) {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    auto& event = _events[_next.fetch_add(1, std::memory_order_relaxed) % _capacity];
+    event.name = name;
+    event.stream = stream;
+    event.thread = currentThreadIndex();
+    event.start = duration_cast<microseconds>(start - _origin).count();
+    event.duration = duration_cast<microseconds>(finish - start).count();
+}
+
+void PerfTrace::dump(std::ostream& stream) const {
+    const size_t last = _next.load();
+    const size_t first = last > _capacity ? last - _capacity : 0;
+    std::lock_guard<std::mutex> lock{_namesMutex};
+    // the same layout as ngraph::event::Duration uses for complete events
+    stream << "[";
+    for (size_t i = first; i < last; i++) {
+        const auto& event = _events[i % _capacity];
+        stream << (i == first ? "\n" : ",\n") << R"({"name":")";
+        writeEscaped(stream, _names[event.name]);
+        stream << R"(","cat":"CPU","ph":"X","pid":)" << event.stream << R"(,"tid":)" << event.thread
+               << R"(,"ts":)" << event.start << R"(,"dur":)" << event.duration << "}";
+    }
+    stream << "\n]\n";
+}
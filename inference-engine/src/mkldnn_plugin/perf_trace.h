@@ -0,0 +1,67 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Fixed size ring buffer of node execution intervals which keeps the latest events.
+ * Recording is lock-free and may be done by several streams at once.
+ */
+class PerfTrace {
+public:
+    using TimePoint = std::chrono::high_resolution_clock::time_point;
+
+    explicit PerfTrace(size_t capacity = 1 << 16);
+
+    /**
+     * @brief Returns the id events with the given name are recorded under. The name is copied, so the trace does
+     * not depend on the lifetime of the node it belongs to
+     */
+    size_t intern(const std::string& name);
+
+    /**
+     * @brief Records execution of a node
+     * @param name Id returned by intern()
+     * @param stream Id of the stream executing the node
+     */
+    void record(size_t name, int stream, TimePoint start, TimePoint finish);
+
+    /**
+     * @brief Writes recorded events in the Chrome trace event format (chrome://tracing) with streams shown as
+     * processes. Events recorded concurrently with the dump may be written partially updated.
+     */
+    void dump(std::ostream& stream) const;
+
+private:
+    struct Event {
+        size_t name;
+        int stream;
+        unsigned thread;
+        int64_t start;
+        int64_t duration;
+    };
+
+    const size_t _capacity;
+    const TimePoint _origin;
+    std::unique_ptr<Event[]> _events;
+    std::atomic<size_t> _next = {0};
+
+    mutable std::mutex _namesMutex;
+    std::deque<std::string> _names;
+    std::unordered_map<std::string, size_t> _nameIds;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
 #include <string>
 #include <vector>
 #include <memory>
@@ -16,23 +17,38 @@ namespace MultiDevicePlugin {
 MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
     const MultiDeviceInferRequest::Ptr&         inferRequest,
     const bool                                  needPerfCounters,
+    const MultiDeviceExecutableNetwork::SchedulingHints& schedulingHints,
     const MultiDeviceExecutableNetwork::Ptr&    multiDeviceExecutableNetwork,
     const ITaskExecutor::Ptr&                   callbackExecutor) :
     AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
     _multiDeviceExecutableNetwork{multiDeviceExecutableNetwork},
     _inferRequest{inferRequest},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _schedulingHints{schedulingHints} {
+    // passes the hints of this request along with the task, the deadline is counted since the request is started
+    struct ThisRequestScheduler : public ITaskExecutor {
+        explicit ThisRequestScheduler(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            const auto& hints = _this->_schedulingHints;
+            const auto deadline = hints._deadline == std::chrono::milliseconds::zero()
+                ? MultiDeviceExecutableNetwork::TimePoint::max()
+                : std::chrono::steady_clock::now() + hints._deadline;
+            _this->_multiDeviceExecutableNetwork->ScheduleToWorkerInferRequest({std::move(task), hints._priority, deadline});
+        };
+        MultiDeviceAsyncInferRequest* _this = nullptr;
+    };
     struct ThisRequestExecutor : public ITaskExecutor {
         explicit ThisRequestExecutor(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
     };
     _pipeline = {
-        {_multiDeviceExecutableNetwork, [this] {
+        {std::make_shared<ThisRequestScheduler>(this), [this] {
             _workerInferRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
             _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
         }},
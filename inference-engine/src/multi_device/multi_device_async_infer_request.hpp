@@ -23,6 +23,7 @@ public:
 
     explicit MultiDeviceAsyncInferRequest(const MultiDeviceInferRequest::Ptr&           inferRequest,
                                           const bool                                    needPerfCounters,
+                                          const MultiDeviceExecutableNetwork::SchedulingHints& schedulingHints,
                                           const MultiDeviceExecutableNetwork::Ptr&      multiDeviceExecutableNetwork,
                                           const InferenceEngine::ITaskExecutor::Ptr&    callbackExecutor);
     void Infer_ThreadUnsafe() override;
@@ -35,6 +36,7 @@ protected:
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
     bool                                                                _needPerfCounters = false;
     MultiDeviceExecutableNetwork::WorkerInferRequest*                   _workerInferRequest = nullptr;
+    MultiDeviceExecutableNetwork::SchedulingHints                       _schedulingHints;
 };
 
 }  // namespace MultiDevicePlugin
@@ -3,7 +3,9 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -48,6 +50,38 @@ struct IdleGuard {
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
 };
 
+namespace {
+int ParseSchedulingHint(const std::string& key, const std::string& value) {
+    int hint = 0;
+    try {
+        std::size_t pos = 0;
+        hint = std::stoi(value, &pos);
+        if (pos != value.size()) {
+            throw std::invalid_argument(value);
+        }
+    } catch (const std::exception&) {
+        THROW_IE_EXCEPTION << "Wrong value " << value << " for the " << key << " key, an integer is expected";
+    }
+    if (key == MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE && hint < 0) {
+        THROW_IE_EXCEPTION << "Wrong value " << value << " for the " << key << " key, it must be >= 0";
+    }
+    return hint;
+}
+
+void SetSchedulingHint(MultiDeviceExecutableNetwork::SchedulingHints& hints, const std::string& key, int value) {
+    if (key == MultiDeviceConfigParams::KEY_MULTI_REQUEST_PRIORITY) {
+        hints._priority = value;
+    } else {
+        hints._deadline = std::chrono::milliseconds(value);
+    }
+}
+
+bool IsSchedulingHint(const std::string& key) {
+    return key == MultiDeviceConfigParams::KEY_MULTI_REQUEST_PRIORITY ||
+           key == MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE;
+}
+}  // namespace
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
@@ -59,6 +93,11 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    for (auto&& value : _config) {
+        if (IsSchedulingHint(value.first)) {
+            SetSchedulingHint(_schedulingHints, value.first, ParseSchedulingHint(value.first, value.second.as<std::string>()));
+        }
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -78,6 +117,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto* latencyPtr = &_deviceLatencies[device];
         workerRequests.resize(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
@@ -86,19 +126,27 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, latencyPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    const std::int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                    // requests of the device complete concurrently, so the average is updated only if no one did it meanwhile
+                    auto average = latencyPtr->load();
+                    while (!latencyPtr->compare_exchange_weak(average,
+                            std::max<std::int64_t>(0 == average ? latency : (7 * average + latency) / 8, 1))) {
+                    }
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
                     }
                     // try to return the request to the idle list (fails if the overall object destruction has began)
                     if (idleGuard.Release()->try_push(workerRequestPtr)) {
-                        // try pop the task, as we know there is at least one idle request
-                        if (_inferPipelineTasks.try_pop(workerRequestPtr->_task)) {
+                        // try pop the most urgent task, as we know there is at least one idle request
+                        PipelineTask pipelineTask;
+                        if (_inferPipelineTasks.try_pop(pipelineTask)) {
                             // if succeeded, let's schedule that
-                            ScheduleToWorkerInferRequest(std::move(workerRequestPtr->_task));
+                            ScheduleToWorkerInferRequest(std::move(pipelineTask));
                         }
                     }
                 });
@@ -106,11 +154,23 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     }
 }
 
-void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask) {
+void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(PipelineTask inferPipelineTask) {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (TimePoint::max() != inferPipelineTask._deadline) {
+        // the devices expected to meet the deadline keep their priority order, the rest follow from the fastest one,
+        // a device that has not run any request yet is assumed to be fast enough
+        const auto timeLeft = std::chrono::duration_cast<std::chrono::microseconds>(
+            inferPipelineTask._deadline - std::chrono::steady_clock::now()).count();
+        std::stable_sort(devices.begin(), devices.end(), [&](const DeviceInformation& a, const DeviceInformation& b) {
+            const auto latencyA = _deviceLatencies.at(a.deviceName).load();
+            const auto latencyB = _deviceLatencies.at(b.deviceName).load();
+            const bool meetsA = latencyA <= timeLeft, meetsB = latencyB <= timeLeft;
+            return meetsA != meetsB ? meetsA : (!meetsA && latencyA < latencyB);
+        });
+    }
     for (auto&& device : devices) {
         WorkerInferRequest* workerRequestPtr = nullptr;
         NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
@@ -118,7 +178,7 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
             {
-                auto capturedTask = std::move(inferPipelineTask);
+                auto capturedTask = std::move(inferPipelineTask._task);
                 capturedTask();
             }
             idleGuard.Release();
@@ -126,11 +186,12 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         }
     }
     // no vacant requests this time, storing the task to the queue
+    inferPipelineTask._order = _numPipelineTasks++;
     _inferPipelineTasks.push(std::move(inferPipelineTask));
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
-    ScheduleToWorkerInferRequest(std::move(inferPipelineTask));
+    ScheduleToWorkerInferRequest({std::move(inferPipelineTask)});
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
@@ -170,8 +231,13 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
     IInferRequest::Ptr asyncRequest;
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto hints = [&] {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _schedulingHints;
+    }();
     auto asyncTreadSafeImpl = std::make_shared<MultiDeviceAsyncInferRequest>(std::static_pointer_cast<MultiDeviceInferRequest>(syncRequestImpl),
                                                                              _needPerfCounters,
+                                                                             hints,
                                                                              std::static_pointer_cast<MultiDeviceExecutableNetwork>(shared_from_this()),
                                                                              _callbackExecutor);
     asyncRequest.reset(new InferRequestBase<MultiDeviceAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
@@ -180,14 +246,20 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
 }
 
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    for (auto&& value : config) {
+        if (value.first != MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES && !IsSchedulingHint(value.first)) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str <<
+                "The only configs supported for the Network's SetConfig are MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES, "
+                "MultiDeviceConfigParams::KEY_MULTI_REQUEST_PRIORITY and MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE";
+        }
+    }
+
+    std::vector<DeviceInformation> metaDevices;
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
-        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str <<
-            "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
-        auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
+        metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
 
         if (std::any_of(metaDevices.begin(), metaDevices.end(), [](const DeviceInformation& kvp) {
                 return kvp.numRequestsPerDevices != -1;
@@ -195,9 +267,18 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "You can only change device priorities but not number of requests"
                      <<" with the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES!";
         }
+    }
+
+    std::map<std::string, int> hints;
+    for (auto&& value : config) {
+        if (IsSchedulingHint(value.first)) {
+            hints[value.first] = ParseSchedulingHint(value.first, value.second.as<std::string>());
+        }
+    }
 
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (priorities != config.end()) {
             for (auto && device : metaDevices) {
                 if (_networksPerDevice.find(device.deviceName) == _networksPerDevice.end()) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "You can only change device priorities but not add new devices with"
@@ -211,6 +292,12 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
         }
+
+        // the hints apply to the infer requests created afterwards
+        for (auto&& hint : hints) {
+            SetSchedulingHint(_schedulingHints, hint.first, hint.second);
+            _config[hint.first] = std::to_string(hint.second);
+        }
     }
 }
 
@@ -250,7 +337,9 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(SUPPORTED_CONFIG_KEYS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_PRIORITY,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -19,6 +21,7 @@
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 # include <tbb/concurrent_queue.h>
+# include <tbb/concurrent_priority_queue.h>
 #endif
 
 namespace MultiDevicePlugin {
@@ -39,6 +42,8 @@ template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
 template <typename T>
 using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
+template <typename T>
+using ThreadSafePriorityQueue = tbb::concurrent_priority_queue<T>;
 #else
 template <typename T>
 class ThreadSafeQueue {
@@ -92,6 +97,27 @@ protected:
     std::mutex      _mutex;
     bool            _capacity = false;
 };
+template <typename T>
+class ThreadSafePriorityQueue {
+public:
+    void push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push(std::move(value));
+    }
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_queue.empty()) {
+            value = _queue.top();
+            _queue.pop();
+            return true;
+        } else {
+            return false;
+        }
+    }
+protected:
+    std::priority_queue<T>  _queue;
+    std::mutex              _mutex;
+};
 #endif
 
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
@@ -102,8 +128,34 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    // Hints captured by the infer requests on creation, see MULTI_REQUEST_PRIORITY and MULTI_REQUEST_DEADLINE
+    struct SchedulingHints {
+        int                         _priority = 0;
+        std::chrono::milliseconds   _deadline = std::chrono::milliseconds::zero();
+    };
+
+    // Tasks waiting for an idle worker request: the higher priority first, then the earliest deadline first,
+    // then in the order of arrival
+    struct PipelineTask {
+        PipelineTask() = default;
+        PipelineTask(InferenceEngine::Task task, int priority = 0, TimePoint deadline = TimePoint::max()) :
+            _task{std::move(task)}, _priority{priority}, _deadline{deadline} {}
+        bool operator<(const PipelineTask& other) const {
+            if (_priority != other._priority) return _priority < other._priority;
+            if (_deadline != other._deadline) return _deadline > other._deadline;
+            return _order > other._order;
+        }
+
+        InferenceEngine::Task   _task;
+        int                     _priority = 0;
+        TimePoint               _deadline = TimePoint::max();
+        std::size_t             _order = 0;
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
@@ -119,7 +171,7 @@ public:
                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
     ~MultiDeviceExecutableNetwork() override;
 
-    void ScheduleToWorkerInferRequest(InferenceEngine::Task);
+    void ScheduleToWorkerInferRequest(PipelineTask);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
@@ -127,8 +179,12 @@ public:
     std::vector<DeviceInformation>                              _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
-    ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
+    ThreadSafePriorityQueue<PipelineTask>                       _inferPipelineTasks;
+    std::atomic_size_t                                          _numPipelineTasks = {0};
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
+    // moving average of the execution time of worker requests in microseconds, 0 until the device runs one
+    DeviceMap<std::atomic<std::int64_t>>                        _deviceLatencies;
+    SchedulingHints                                             _schedulingHints;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
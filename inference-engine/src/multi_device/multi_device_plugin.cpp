@@ -140,6 +140,8 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_REQUEST_PRIORITY,
+            MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -168,6 +170,12 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    for (auto&& hint : {MultiDeviceConfigParams::KEY_MULTI_REQUEST_PRIORITY, MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE}) {
+        auto itHint = fullConfig.find(hint);
+        if (itHint != fullConfig.end()) {
+            multiNetworkConfig.insert(*itHint);
+        }
+    }
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     for (auto& p : metaDevices) {
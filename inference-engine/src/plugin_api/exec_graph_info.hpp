@@ -51,6 +51,18 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a median execution time of the executable primitive.
+ */
+static const char PERF_COUNTER_P50[] = "execTimeMcsP50";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a 99th percentile of execution time of the executable primitive.
+ */
+static const char PERF_COUNTER_P99[] = "execTimeMcsP99";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
@@ -84,6 +96,8 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::IMPL_TYPE
  * - ExecGraphInfoSerialization::OUTPUT_PRECISIONS
  * - ExecGraphInfoSerialization::PERF_COUNTER
+ * - ExecGraphInfoSerialization::PERF_COUNTER_P50 (optional)
+ * - ExecGraphInfoSerialization::PERF_COUNTER_P99 (optional)
  * - ExecGraphInfoSerialization::OUTPUT_LAYOUTS
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
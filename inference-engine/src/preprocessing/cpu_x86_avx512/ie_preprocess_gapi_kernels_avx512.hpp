@@ -107,6 +107,30 @@ void calcRowLinear_32F(float *dst[],
                        const Size & outSz,
                        int    lpi);
 
+// Resize (bi-cubic/Lanczos, 8U)
+void calcRowSeparable_8U(uint8_t *dst[],
+                         const uint8_t *src[],
+                         const float  alpha[],
+                         const int    mapsx[],
+                         const float  beta[],
+                               float  tmp[],
+                         const Size & inSz,
+                         const Size & outSz,
+                               int    taps,
+                               int    lpi);
+
+// Resize (bi-cubic/Lanczos, 32F)
+void calcRowSeparable_32F(float *dst[],
+                          const float *src[],
+                          const float  alpha[],
+                          const int    mapsx[],
+                          const float  beta[],
+                                float  tmp[],
+                          const Size & inSz,
+                          const Size & outSz,
+                                int    taps,
+                                int    lpi);
+
 //----------------------------------------------------------------------
 
 void mergeRow_8UC2(const uint8_t in0[],
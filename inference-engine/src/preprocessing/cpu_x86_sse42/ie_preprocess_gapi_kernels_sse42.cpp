@@ -903,6 +903,32 @@ void calcRowLinear_32F(float *dst[],
     calcRowLinear_32FC1(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
 }
 
+void calcRowSeparable_8U(uint8_t *dst[],
+                         const uint8_t *src[],
+                         const float  alpha[],
+                         const int    mapsx[],
+                         const float  beta[],
+                               float  tmp[],
+                         const Size & inSz,
+                         const Size & outSz,
+                               int    taps,
+                               int    lpi) {
+    calcRowSeparable_impl(dst, src, alpha, mapsx, beta, tmp, inSz, outSz, taps, lpi);
+}
+
+void calcRowSeparable_32F(float *dst[],
+                          const float *src[],
+                          const float  alpha[],
+                          const int    mapsx[],
+                          const float  beta[],
+                                float  tmp[],
+                          const Size & inSz,
+                          const Size & outSz,
+                                int    taps,
+                                int    lpi) {
+    calcRowSeparable_impl(dst, src, alpha, mapsx, beta, tmp, inSz, outSz, taps, lpi);
+}
+
 //------------------------------------------------------------------------------
 
 void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz, const Size& outSz,
@@ -642,6 +642,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_BICUBIC:  return cv::INTER_CUBIC;
+            case RESIZE_LANCZOS4: return cv::INTER_LANCZOS4;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -684,7 +686,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()), _roiComp(parallel_get_max_threads()) {}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -769,10 +771,11 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob, an NV12, or an I420 blob
+    // src is either a memory blob, an NV12, an I420 or a ROI batched blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
-        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+    if (!src->is<MemoryBlob>() && !yuv420_blob && !src->is<ROIBatchedBlob>()) {
+        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob, I420Blob "
+                               "or ROIBatchedBlob";
     }
 
     // dst is always a memory blob
@@ -807,7 +810,11 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<ROIBatchedBlob>()) {
+        // every region is a separate batch item, the rest of the network's batch is left untouched
+        const auto regions = static_cast<int>(blob->as<ROIBatchedBlob>()->size());
+        batch = batch < 0 ? regions : std::min(batch, regions);
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -980,6 +987,116 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
     return true;
 }
 
+bool PreprocEngine::preprocessROIBatch(const ROIBatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size) {
+    if (in_fmt == ColorFormat::NV12 || in_fmt == ColorFormat::I420) {
+        THROW_IE_EXCEPTION  << "Unsupported input color format " << in_fmt << " for ROIBatchedBlob";
+    }
+
+    const auto& in_desc_ie = inBlob->getTensorDesc();
+    const auto& out_desc_ie = outBlob->getTensorDesc();
+    validateTensorDesc(in_desc_ie);
+    validateTensorDesc(out_desc_ie);
+
+    const G::Desc out_desc = G::decompose(out_desc_ie);
+    if (batch_size < 0 || batch_size > static_cast<int>(inBlob->size())) {
+        batch_size = static_cast<int>(inBlob->size());
+    }
+    if (batch_size > out_desc.d.N) {
+        THROW_IE_EXCEPTION  << "Number of regions is invalid: (provided)"
+                            << batch_size << " > " << out_desc.d.N << " (expected by network)";
+    }
+
+    // Sizes of regions change from call to call and from region to region, so they are not
+    // a part of the call description: a compiled graph is reshaped to them instead
+    auto in_dims = in_desc_ie.getDims();
+    in_dims[0] = in_dims[2] = in_dims[3] = 1;
+    CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_desc_ie.getLayout(),
+                                            in_dims,
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_desc_ie.getLayout(),
+                                            out_desc_ie.getDims(),
+                                            out_fmt },
+                                  algorithm };
+    if (!_lastROICall || *_lastROICall != thisCall) {
+        _lastROICall = cv::util::make_optional(std::move(thisCall));
+        _roiComputation.fill({});
+        std::fill(_roiComp.begin(), _roiComp.end(), ROIGraph{});
+    }
+
+    const auto is_upscale = [&](const G::Desc& in_desc) {
+        return algorithm == RESIZE_AREA && (in_desc.d.H < out_desc.d.H || in_desc.d.W < out_desc.d.W);
+    };
+
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        const auto& roiBlob = inBlob->getBlob(i);
+        const auto in_desc = G::decompose(roiBlob);
+        auto& computation = _roiComputation[is_upscale(in_desc)];
+        if (!computation) {
+            //  AREA kernels are chosen by the scaling mode, so each mode has its own graph
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            computation = cv::util::make_optional(
+                buildGraph(in_desc,
+                           out_desc,
+                           in_desc_ie.getLayout(),
+                           out_desc_ie.getLayout(),
+                           algorithm,
+                           in_fmt,
+                           out_fmt));
+        }
+        batched_input_plane_mats[i] = std::move(bind_to_blob(roiBlob, 1)[0]);
+    }
+    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // Unlike a regular batch, regions are distributed between threads as a whole
+    parallel_nt_static(thread_num, [&, this](int ithr, const int nthr) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+
+        auto& graph = _roiComp[ithr];
+        for (int i = ithr; i < batch_size; i += nthr) {
+            const auto& input_plane_mats = batched_input_plane_mats[i];
+            auto& output_plane_mats = batched_output_plane_mats[i];
+
+            const cv::gapi::own::Size size{input_plane_mats[0].cols, input_plane_mats[0].rows};
+            const bool upscale = is_upscale(G::decompose(inBlob->getBlob(i)));
+            if (!graph.compiled || graph.upscale != upscale) {
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+                graph.compiled = _roiComputation[upscale]->compile(descrs_of(input_plane_mats),
+                                                                  cv::compile_args(gapi::preprocKernels()));
+                graph.size = size;
+                graph.upscale = upscale;
+            } else if (!(graph.size == size)) {
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+                graph.compiled.reshape(descrs_of(input_plane_mats), cv::compile_args(gapi::preprocKernels()));
+                graph.size = size;
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
+            graph.compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
+
+    return true;
+}
+
 bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
     if (!useGAPI()) {
@@ -994,6 +1111,11 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    if (auto inROIBatchedBlob = as<ROIBatchedBlob>(inBlob)) {
+        return preprocessROIBatch(inROIBatchedBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <array>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -29,6 +30,17 @@ class PreprocEngine {
     Opt<CallDesc> _lastCall;
     std::vector<cv::GCompiled> _lastComp;
 
+    // Regions of a ROIBatchedBlob share one graph per AREA scaling mode (downscale, upscale),
+    // every thread keeps its own compiled copy and reshapes it to the size of a next region
+    struct ROIGraph {
+        cv::GCompiled compiled;
+        cv::gapi::own::Size size;
+        bool upscale = false;
+    };
+    Opt<CallDesc> _lastROICall;
+    std::array<Opt<cv::GComputation>, 2> _roiComputation;
+    std::vector<ROIGraph> _roiComp;
+
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
     openvino::itt::handle_t _perf_exec_graph = openvino::itt::handle("Preproc Exec Graph");
@@ -49,6 +61,10 @@ class PreprocEngine {
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
+    bool preprocessROIBatch(const ROIBatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size);
+
 public:
     PreprocEngine();
     static bool useGAPI();
@@ -31,6 +31,8 @@
 #include <opencv2/gapi/gcompoundkernel.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -812,10 +814,34 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+// Gathers rows [y - taps/2 + 1, y + taps/2] of the input into a row y of the output,
+// one after another, so that Resize kernels can get all the vertical taps from a single row
+G_TYPED_KERNEL(GatherRows, <cv::GMat(cv::GMat, int)>, "com.intel.ie.gather_rows") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, int taps) {
+        GAPI_DbgAssert(in.chan == 1);
+        return in.withType(in.depth, taps);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneSeparable8u, <cv::GMat(cv::GMat, Size)>, "com.intel.ie.scale_plane_separable_8u") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz) {
+        GAPI_DbgAssert(in.depth == CV_8U);
+        return in.withType(in.depth, 1).withSize(sz);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneSeparable32f, <cv::GMat(cv::GMat, Size)>, "com.intel.ie.scale_plane_separable_32f") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz) {
+        GAPI_DbgAssert(in.depth == CV_32F);
+        return in.withType(in.depth, 1).withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp ||
+                       cv::INTER_CUBIC == interp || cv::INTER_LANCZOS4 == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -842,6 +868,18 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        if (cv::INTER_CUBIC == interp || cv::INTER_LANCZOS4 == interp) {
+            // number of input pixels an output pixel is interpolated from
+            const int taps = cv::INTER_LANCZOS4 == interp ? 8 : 4;
+            auto rows = GatherRows::on(in, taps);
+            if (CV_8UC1 == type) {
+                return ScalePlaneSeparable8u::on(rows, szOut);
+            }
+            if (CV_32FC1 == type) {
+                return ScalePlaneSeparable32f::on(rows, szOut);
+            }
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -1953,6 +1991,215 @@ static void calcAreaRow_CVKL_U8(const cv::gapi::fluid::View   & in,
 #endif  // CVKL
 //----------------------------------------------------------------------
 
+//----------------------------------------------------------------------
+
+namespace separable {
+// weights of the taps around a point at a distance f from the (taps/2 - 1)-th of them,
+// the same as OpenCV uses for INTER_CUBIC and INTER_LANCZOS4
+static inline void weights(int taps, float f, float w[]) {
+    if (taps == 4) {
+        constexpr float A = -0.75f;
+        w[0] = ((A*(f + 1) - 5*A)*(f + 1) + 8*A)*(f + 1) - 4*A;
+        w[1] = ((A + 2)*f - (A + 3))*f*f + 1;
+        w[2] = ((A + 2)*(1 - f) - (A + 3))*(1 - f)*(1 - f) + 1;
+        w[3] = 1.f - w[0] - w[1] - w[2];
+        return;
+    }
+
+    constexpr double pi = 3.14159265358979323846;
+    float sum = 0.f;
+    for (int k = 0; k < taps; k++) {
+        const double d = (f + taps/2 - 1 - k) * pi;
+        w[k] = d*d < 1e-12 ? 1.f : static_cast<float>(taps/2 * std::sin(d) * std::sin(d / (taps/2)) / (d*d));
+        sum += w[k];
+    }
+    for (int k = 0; k < taps; k++) {
+        w[k] /= sum;
+    }
+}
+
+struct ScratchDesc {
+    float* alpha;  // taps x outW horizontal weights
+    int*   mapsx;  // position of the first horizontal tap in tmp
+    float* beta;   // outH x taps vertical weights
+    int*   mapsy;  // input row the vertical taps are gathered around
+    float* tmp;    // input row blended with vertical weights, with taps pixels of border at both sides
+
+    ScratchDesc(int /*inW*/, int outW, int outH, int taps, void* data) {
+        alpha = reinterpret_cast<float*>(data);
+        mapsx = reinterpret_cast<int*>  (alpha + taps*outW);
+        beta  = reinterpret_cast<float*>(mapsx + outW);
+        mapsy = reinterpret_cast<int*>  (beta  + outH*taps);
+        tmp   = reinterpret_cast<float*>(mapsy + outH);
+    }
+
+    static int bufSize(int inW, int outW, int outH, int taps) {
+        auto size = outW * taps * sizeof(float) +
+                    outW        * sizeof(int)   +
+                    outH * taps * sizeof(float) +
+                    outH        * sizeof(int)   +
+                    (inW + 2*taps) * sizeof(float);
+
+        return static_cast<int>(size);
+    }
+};
+}  // namespace separable
+
+static void initScratchSeparable(const cv::GMatDesc& in,
+                                 const         Size& outSz,
+                            cv::gapi::fluid::Buffer& scratch) {
+    const auto inSz = in.size;
+    const int taps = in.chan;
+    const int center = taps/2 - 1;
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = Size{separable::ScratchDesc::bufSize(inSz.width, outSz.width, outSz.height, taps), 1};
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    separable::ScratchDesc scr(inSz.width, outSz.width, outSz.height, taps, scratch.OutLineB());
+
+    float w[8];
+    const double hRatio = ratio(inSz.width, outSz.width);
+    for (int x = 0; x < outSz.width; x++) {
+        float f = static_cast<float>((x + 0.5) * hRatio - 0.5);
+        int s = cvFloor(f);
+        separable::weights(taps, f - s, w);
+
+        for (int k = 0; k < taps; k++) {
+            scr.alpha[k*outSz.width + x] = w[k];
+        }
+        // taps out of the row are read from the border of tmp
+        scr.mapsx[x] = s - center + taps;
+    }
+
+    const double vRatio = ratio(inSz.height, outSz.height);
+    for (int y = 0; y < outSz.height; y++) {
+        float f = static_cast<float>((y + 0.5) * vRatio - 0.5);
+        int s = cvFloor(f);
+        separable::weights(taps, f - s, w);
+
+        // Fluid provides only input rows a linear resize would read, so s = -1 of upscale
+        // is replaced with 0 and weights of the rows outside the image are moved to the ones
+        // which replicate them
+        const int base = std::min(std::max(s, 0), inSz.height - 1);
+        auto *beta = scr.beta + y*taps;
+        std::fill(beta, beta + taps, 0.f);
+        for (int k = 0; k < taps; k++) {
+            const int row = std::min(std::max(s - center + k, 0), inSz.height - 1);
+            const int tap = row - base + center;
+            GAPI_DbgAssert(0 <= tap && tap < taps);
+            beta[tap] += w[k];
+        }
+        scr.mapsy[y] = base;
+    }
+}
+
+template<typename T>
+static void calcRowSeparable(const cv::gapi::fluid::View  & in,
+                                   cv::gapi::fluid::Buffer& out,
+                                   cv::gapi::fluid::Buffer& scratch) {
+    const auto  inSz =  in.meta().size;
+    const auto outSz = out.meta().size;
+    const int taps = in.meta().chan;
+
+    const int inY = in.y();
+    const int outY = out.y();
+    const int lpi = out.lpi();
+    GAPI_DbgAssert(outY + lpi <= outSz.height);
+    GAPI_DbgAssert(lpi <= 4);
+
+    separable::ScratchDesc scr(inSz.width, outSz.width, outSz.height, taps, scratch.OutLineB());
+
+    const float *beta = scr.beta + outY*taps;
+    const T *src[4];
+    T *dst[4];
+    for (int l = 0; l < lpi; l++) {
+        src[l] = in.InLine<const T>(scr.mapsy[outY + l] - inY);
+        dst[l] = out.OutLine<T>(l);
+    }
+
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::calcRowSeparable_8U(reinterpret_cast<uint8_t**>(dst),
+                                        reinterpret_cast<const uint8_t**>(src),
+                                        scr.alpha, scr.mapsx, beta, scr.tmp, inSz, outSz, taps, lpi);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowSeparable_32F(reinterpret_cast<float**>(dst),
+                                         reinterpret_cast<const float**>(src),
+                                         scr.alpha, scr.mapsx, beta, scr.tmp, inSz, outSz, taps, lpi);
+            return;
+        }
+    }
+    #endif
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::calcRowSeparable_8U(reinterpret_cast<uint8_t**>(dst),
+                                     reinterpret_cast<const uint8_t**>(src),
+                                     scr.alpha, scr.mapsx, beta, scr.tmp, inSz, outSz, taps, lpi);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowSeparable_32F(reinterpret_cast<float**>(dst),
+                                      reinterpret_cast<const float**>(src),
+                                      scr.alpha, scr.mapsx, beta, scr.tmp, inSz, outSz, taps, lpi);
+            return;
+        }
+    }
+    #endif
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            calcRowSeparable_8U(reinterpret_cast<uint8_t**>(dst),
+                                reinterpret_cast<const uint8_t**>(src),
+                                scr.alpha, scr.mapsx, beta, scr.tmp, inSz, outSz, taps, lpi);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            calcRowSeparable_32F(reinterpret_cast<float**>(dst),
+                                 reinterpret_cast<const float**>(src),
+                                 scr.alpha, scr.mapsx, beta, scr.tmp, inSz, outSz, taps, lpi);
+            return;
+        }
+    }
+    #endif
+
+    float *row = scr.tmp + taps;
+    for (int l = 0; l < lpi; l++) {
+        for (int x = 0; x < inSz.width; x++) {
+            float sum = 0.f;
+            for (int k = 0; k < taps; k++) {
+                sum += src[l][k*inSz.width + x] * beta[l*taps + k];
+            }
+            row[x] = sum;
+        }
+        for (int k = 1; k <= taps; k++) {
+            row[-k] = row[0];
+            row[inSz.width - 1 + k] = row[inSz.width - 1];
+        }
+
+        for (int x = 0; x < outSz.width; x++) {
+            float sum = 0.f;
+            for (int k = 0; k < taps; k++) {
+                sum += scr.tmp[scr.mapsx[x] + k] * scr.alpha[k*outSz.width + x];
+            }
+            dst[l][x] = saturate_cast<T>(sum);
+        }
+    }
+}
+
 GAPI_FLUID_KERNEL(FScalePlane8u, ScalePlane8u, true) {
     static const int Window = 1;
     static const int LPI = 4;
@@ -2155,6 +2402,61 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+GAPI_FLUID_KERNEL(FGatherRows, GatherRows, false) {
+    static int getWindow(const cv::GMatDesc& /*in*/, int taps) {
+        return taps + 1;
+    }
+
+    static cv::gapi::fluid::Border getBorder(const cv::GMatDesc& /*in*/, int /*taps*/) {
+        return {cv::BORDER_REPLICATE, {}};
+    }
+
+    static void run(const cv::gapi::fluid::View& in, int taps, cv::gapi::fluid::Buffer& out) {
+        const auto rowSize = in.length() * (in.meta().depth == CV_32F ? sizeof(float) : sizeof(uint8_t));
+        for (int k = 0; k < taps; k++) {
+            std::memcpy(out.OutLineB() + k*rowSize, in.InLineB(k + 1 - taps/2), rowSize);
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneSeparable8u, ScalePlaneSeparable8u, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in, Size outSz,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchSeparable(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        calcRowSeparable<uint8_t>(in, out, scratch);
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneSeparable32f, ScalePlaneSeparable32f, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in, Size outSz,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchSeparable(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        calcRowSeparable<float>(in, out, scratch);
+    }
+};
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -2398,6 +2700,9 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FGatherRows
+        , FScalePlaneSeparable8u
+        , FScalePlaneSeparable32f
         , FMerge2
         , FMerge3
         , FMerge4
@@ -2,6 +2,7 @@
 #define IE_PREPROCESS_GAPI_KERNELS_SIMD_IMPL_H
 
 #include <algorithm>
+#include <type_traits>
 #include <utility>
 
 #include "ie_preprocess_gapi_kernels_impl.hpp"
@@ -911,6 +912,105 @@ static inline void calcRowLinear_32FC1(float *dst[],
     }
 }
 
+//------------------------------------------------------------------------------
+
+#if MANUAL_SIMD
+static inline v_float32 load_f32(const float *src) {
+    return vx_load(src);
+}
+
+static inline v_float32 load_f32(const uint8_t *src) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(src)));
+}
+
+static inline void store_f32(float dst[], const v_float32 res[]) {
+    vx_store(dst, res[0]);
+}
+
+static inline void store_f32(uint8_t dst[], const v_float32 res[]) {
+    vx_store(dst, v_pack_u(v_pack(v_round(res[0]), v_round(res[1])),
+                           v_pack(v_round(res[2]), v_round(res[3]))));
+}
+#endif
+
+// Resize (bi-cubic/Lanczos, 8U/32F)
+//
+// src[l] holds `taps` input rows one after another, beta[l*taps + k] is a weight of the k-th one.
+// The rows are blended into tmp first, so that horizontal taps of an output pixel
+// dst[l][x] = sum(alpha[k*outW + x] * tmp[mapsx[x] + k]) are read from a single row
+// padded with `taps` replicated pixels on both sides.
+template<typename T>
+static inline void calcRowSeparable_impl(T *dst[],
+                                         const T *src[],
+                                         const float alpha[],
+                                         const int   mapsx[],
+                                         const float beta[],
+                                         float tmp[],
+                                         const Size& inSz,
+                                         const Size& outSz,
+                                         int taps,
+                                         int lpi) {
+    const int inW = inSz.width, outW = outSz.width;
+    float *row = tmp + taps;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    // 8U result is packed from four vectors at once
+    constexpr int nvecs = std::is_same<T, uint8_t>::value ? 4 : 1;
+#endif
+
+    for (int l = 0; l < lpi; l++) {
+        const float *b = beta + l * taps;
+
+        int x = 0;
+#if MANUAL_SIMD
+        for (; x <= inW - nlanes; x += nlanes) {
+            v_float32 sum = vx_setzero_f32();
+            for (int k = 0; k < taps; k++) {
+                sum = v_fma(load_f32(src[l] + k * inW + x), vx_setall_f32(b[k]), sum);
+            }
+            vx_store(&row[x], sum);
+        }
+#endif
+        for (; x < inW; x++) {
+            float sum = 0.f;
+            for (int k = 0; k < taps; k++) {
+                sum += src[l][k * inW + x] * b[k];
+            }
+            row[x] = sum;
+        }
+
+        for (int k = 1; k <= taps; k++) {
+            row[-k] = row[0];
+            row[inW - 1 + k] = row[inW - 1];
+        }
+
+        x = 0;
+#if MANUAL_SIMD
+        for (; x <= outW - nvecs * nlanes; x += nvecs * nlanes) {
+            v_float32 res[nvecs];
+            for (int v = 0; v < nvecs; v++) {
+                const int xv = x + v * nlanes;
+                v_int32 idx = vx_load(&mapsx[xv]);
+                v_float32 sum = vx_setzero_f32();
+                for (int k = 0; k < taps; k++) {
+                    sum = v_fma(v_lut(tmp + k, idx), vx_load(&alpha[k * outW + xv]), sum);
+                }
+                res[v] = sum;
+            }
+            store_f32(&dst[l][x], res);
+        }
+#endif
+        for (; x < outW; x++) {
+            float sum = 0.f;
+            for (int k = 0; k < taps; k++) {
+                sum += tmp[mapsx[x] + k] * alpha[k * outW + x];
+            }
+            dst[l][x] = saturate_cast<T>(sum);
+        }
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
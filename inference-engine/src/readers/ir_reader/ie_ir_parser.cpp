@@ -4,6 +4,7 @@
 
 #include "ie_ir_parser.hpp"
 #include "ie_ir_itt.hpp"
+#include "ie_xml_stream_reader.hpp"
 
 #include <typeinfo>
 #include <unordered_set>
@@ -24,6 +25,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 
 #include <cpp/ie_cnn_network.h>
 #include "ie_blob_stream.hpp"
@@ -51,6 +53,10 @@ std::shared_ptr<ICNNNetwork> IRParser::parse(const pugi::xml_node& root, const B
     return parser->parse(root, weights);
 }
 
+std::shared_ptr<ICNNNetwork> IRParser::parse(std::istream& model, const Blob::CPtr& weights) {
+    return parser->parse(model, weights);
+}
+
 /**
  * Hold original blob in order to avoid situations when original blob is allocated on stack
  */
@@ -86,39 +92,127 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
 std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const Blob::CPtr& weights) {
     OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
-    using node_params = struct {
-        pugi::xml_node xml;
-        GenericLayerParams params;
-    };
-    std::map<size_t, node_params> params;
-
-    std::vector<size_t> outputs;
-    std::unordered_set<std::string> opName;
+    NetworkDescription description;
+    std::map<size_t, pugi::xml_node> layerNodes;
 
     // Read all layers and store their parameters in params map
     FOREACH_CHILD(node, root.child("layers"), "layer") {
         auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end())
-            THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
-        }
+        layerNodes[node_param.layerId] = node;
+        description.addLayer(node_param);
     }
 
-    using edge = struct { size_t fromLayerId, fromPortId, toPortId; };
-    std::map<size_t, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
-
     // Read all edges and store them for further usage
     FOREACH_CHILD(_ec, root.child("edges"), "edge") {
-        size_t fromLayer = GetUIntAttr(_ec, "from-layer");
-        size_t fromPort = GetUIntAttr(_ec, "from-port");
-        size_t toLayer = GetUIntAttr(_ec, "to-layer");
-        size_t toPort = GetUIntAttr(_ec, "to-port");
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+        description.addEdge(_ec);
+    }
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphFunction");
+
+    auto function = createFunction(description, GetStrAttr(root, "name", ""), [&layerNodes](size_t layerId) {
+        return layerNodes[layerId];
+    }, weights);
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructCNNNetwork");
+
+    CNNNetwork net(function, _exts);
+
+    parsePreProcess(net, root, weights);
+
+    return net;
+}
+
+std::shared_ptr<ICNNNetwork> V10Parser::parse(std::istream& model, const Blob::CPtr& weights) {
+    if (model.tellg() < 0)
+        return IParser::parse(model, weights);
+
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "ScanStream");
+
+    // Edges are listed after all layers, so the layers are only located during the first pass over the stream
+    // and every node is created later from a document which holds its layer alone
+    NetworkDescription description;
+    std::map<size_t, std::pair<std::streamoff, size_t>> layerLocations;
+    std::string preProcess;
+
+    pugi::xml_document fragment;
+    auto loadFragment = [&fragment](const std::string& text, std::streamoff offset) {
+        pugi::xml_parse_result res = fragment.load_buffer(text.data(), text.size());
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << offset + res.offset;
+        }
+        return fragment.document_element();
+    };
+
+    details::XmlStreamReader reader(model);
+    reader.read([](const details::XmlStreamReader::Path& path) {
+        return (path.size() == 3 && path[1] == "layers" && path[2] == "layer") ||
+               (path.size() == 3 && path[1] == "edges" && path[2] == "edge") ||
+               (path.size() == 2 && path[1] == "pre-process");
+    }, [&](const details::XmlStreamReader::Path& path, const std::string& text, std::streamoff offset) {
+        if (path.back() == "pre-process") {
+            preProcess = text;
+            return;
+        }
+        auto node = loadFragment(text, offset);
+        if (path.back() == "edge") {
+            description.addEdge(node);
+            return;
+        }
+        auto node_param = parseGenericParams(node);
+        layerLocations[node_param.layerId] = {offset, text.size()};
+        description.addLayer(node_param);
+    });
+    const std::string name = GetStrAttr(loadFragment(reader.rootTag(), 0), "name", "");
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphFunction");
+
+    std::string layerText;
+    auto function = createFunction(description, name, [&](size_t layerId) {
+        const auto& location = layerLocations.at(layerId);
+        layerText.resize(location.second);
+        model.clear();
+        model.seekg(location.first);
+        if (!model.read(&layerText[0], layerText.size()))
+            THROW_IE_EXCEPTION << "Cannot read layer with id: " << layerId << " from the model stream";
+        return loadFragment(layerText, location.first);
+    }, weights);
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructCNNNetwork");
+
+    CNNNetwork net(function, _exts);
+
+    pugi::xml_document preProcessDoc;
+    if (!preProcess.empty())
+        preProcessDoc.load_buffer(preProcess.data(), preProcess.size());
+    parsePreProcess(net, preProcessDoc, weights);
+
+    return net;
+}
+
+void V10Parser::NetworkDescription::addLayer(const GenericLayerParams& layerParams) {
+    if (names.find(layerParams.name) != names.end())
+        THROW_IE_EXCEPTION << "Invalid IR! " << layerParams.name << " name is not unique!";
+    names.insert(layerParams.name);
+    params[layerParams.layerId] = layerParams;
+    if (layerParams.type == "Result" || layerParams.type == "Assign") {
+        outputs.push_back(layerParams.layerId);
     }
+}
+
+void V10Parser::NetworkDescription::addEdge(const pugi::xml_node& node) {
+    size_t fromLayer = GetUIntAttr(node, "from-layer");
+    size_t fromPort = GetUIntAttr(node, "from-port");
+    size_t toLayer = GetUIntAttr(node, "to-layer");
+    size_t toPort = GetUIntAttr(node, "to-port");
+    edges[toLayer].push_back({fromLayer, fromPort, toPort});
+}
+
+std::shared_ptr<ngraph::Function> V10Parser::createFunction(NetworkDescription& description, const std::string& name,
+                                                            const std::function<pugi::xml_node(size_t)>& layerNode,
+                                                            const Blob::CPtr& weights) {
+    auto& params = description.params;
+    auto& edges = description.edges;
+    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
 
     // Run DFS starting from outputs to get nodes topological order
     std::set<size_t> used;
@@ -131,9 +225,7 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
         }
         order.push_back(id);
     };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
-
-    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
+    std::for_each(description.outputs.begin(), description.outputs.end(), dfs);
 
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
@@ -143,6 +235,9 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
 
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
+        if (params.find(layer_id) == params.end()) {
+            THROW_IE_EXCEPTION << "Attempt to access node " << layer_id << " that not in graph.";
+        }
         auto& p = params[layer_id];
         ngraph::OutputVector inputs(edges[layer_id].size());
         for (auto& e : edges[layer_id]) {
@@ -150,26 +245,26 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
             if (!input_node) {
                 THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
             }
-            auto& p_output = params[e.fromLayerId].params;
-            if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
-                THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
+            auto& p_output = params[e.fromLayerId];
+            if (p.getRealInputPortId(e.toPortId) >= inputs.size())
+                THROW_IE_EXCEPTION << p.type << " layer " << p.name << " with id: " << p.layerId
                     << " is inconsistent!";
-            inputs[p.params.getRealInputPortId(e.toPortId)] =
+            inputs[p.getRealInputPortId(e.toPortId)] =
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        auto node = createNode(inputs, layerNode(layer_id), weights, p);
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
         // Temporary disabled!
-        //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
-        //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
+        //        for (size_t i = 0; i < p.outputPorts.size(); ++i) {
+        //            if (p.outputPorts[i].dims != node->output(i).get_shape()) {
         //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
         //                details::dumpVec(node->output(i).get_shape())
         //                                   << " differ from IR shapes: " <<
-        //                                   details::dumpVec(p.params.outputPorts[i].dims);
+        //                                   details::dumpVec(p.outputPorts[i].dims);
         //            }
         //        }
 
@@ -191,22 +286,13 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
         allNodes.emplace_back(node);
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphFunction");
-
     ::ngraph::op::GenericIE::DisableReshape noReshape(allNodes);
-    auto function = std::make_shared<ngraph::Function>(result_nodes, assign_nodes, parameter_nodes, GetStrAttr(root, "name", ""));
+    auto function = std::make_shared<ngraph::Function>(result_nodes, assign_nodes, parameter_nodes, name);
     for (const auto& assign : assign_nodes) {
         assign->add_control_dependency(
             variable_id_to_read_value.at(std::dynamic_pointer_cast<ngraph::op::Assign>(assign)->get_variable_id()));
     }
-
-    OV_ITT_TASK_NEXT(taskChain, "ConstructCNNNetwork");
-
-    CNNNetwork net(function, _exts);
-
-    parsePreProcess(net, root, weights);
-
-    return net;
+    return function;
 }
 
 void V10Parser::parsePreProcess(CNNNetwork& network, const pugi::xml_node& root, const Blob::CPtr& weights) {
@@ -397,6 +483,7 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
                                                     const GenericLayerParams& params) {
     static std::vector<std::shared_ptr<LayerBaseCreator>> creators = {
         std::make_shared<LayerCreator<ngraph::op::v1::AvgPool>>("AvgPool"),
+        std::make_shared<LayerCreator<ngraph::op::Constant>>("Const"),
         std::make_shared<LayerCreator<ngraph::op::Convert>>("Convert"),
         std::make_shared<LayerCreator<ngraph::op::CTCGreedyDecoder>>("CTCGreedyDecoder"),
         std::make_shared<LayerCreator<ngraph::op::v1::DeformableConvolution>>("DeformableConvolution"),
@@ -1050,6 +1137,36 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Result>::creat
     return std::make_shared<ngraph::op::Result>(inputs[0]);
 }
 
+// Const layer
+template <>
+std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::createLayer(
+    const ngraph::OutputVector& inputs, const pugi::xml_node& node, const Blob::CPtr& weights,
+    const GenericLayerParams& layerParsePrms) {
+    checkParameters(inputs, layerParsePrms, 0);
+    pugi::xml_node dn = node.child("data");
+    if (dn.empty())
+        THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
+
+    size_t offset = GetUInt64Attr(dn, "offset");
+    size_t size = GetUInt64Attr(dn, "size");
+    ngraph::element::Type el_type = details::convertPrecision(GetStrAttr(dn, "element_type"));
+    ngraph::Shape shape = getParameters<size_t>(dn, "shape", {});
+
+    if (!weights || !weights->byteSize())
+        THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+    if (weights->byteSize() < offset + size)
+        THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+    if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
+        THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << getType() << " op!";
+
+    // Constant references the weights blob directly instead of copying the data, so memory mapped
+    // weights stay shared with the page cache
+    Blob::CPtr weightsHolder = weights;
+    char* data = weights->cbuffer().as<char*>() + offset;
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, weightsHolder);
+    return std::make_shared<ngraph::op::Constant>(el_type, shape, buffer);
+}
+
 // Tile layer
 template <>
 std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v0::Tile>::createLayer(
@@ -17,11 +17,14 @@
 
 #include <cctype>
 #include <algorithm>
+#include <functional>
+#include <istream>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace InferenceEngine {
@@ -31,6 +34,18 @@ public:
     using Ptr = std::shared_ptr<IParser>;
     virtual ~IParser() = default;
     virtual std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights) = 0;
+
+    /**
+     * @brief Parses the model from the stream, by default the whole XML document is loaded first
+     */
+    virtual std::shared_ptr<ICNNNetwork> parse(std::istream& model, const Blob::CPtr& weights) {
+        pugi::xml_document xmlDoc;
+        pugi::xml_parse_result res = xmlDoc.load(model);
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
+        }
+        return parse(xmlDoc.document_element(), weights);
+    }
 };
 
 class IRParser {
@@ -38,6 +53,7 @@ public:
     explicit IRParser(size_t version);
     IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts);
     std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights);
+    std::shared_ptr<ICNNNetwork> parse(std::istream& model, const Blob::CPtr& weights);
     virtual ~IRParser() = default;
 
 private:
@@ -57,6 +73,13 @@ public:
     explicit V10Parser(const std::vector<IExtensionPtr>& exts);
     std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights) override;
 
+    /**
+     * @brief Parses the model without loading the whole XML document: the layers are located in the stream first
+     * and then every node is created from a document of its layer only. Streams without random access are
+     * parsed as a whole document.
+     */
+    std::shared_ptr<ICNNNetwork> parse(std::istream& model, const Blob::CPtr& weights) override;
+
 private:
     std::map<std::string, ngraph::OpSet> opsets;
     const std::vector<IExtensionPtr> _exts;
@@ -174,6 +197,26 @@ private:
     std::shared_ptr<ngraph::Node> createNode(const ngraph::OutputVector& inputs, const pugi::xml_node& node,
                                              const Blob::CPtr& weights, const GenericLayerParams& params);
 
+    struct Edge {
+        size_t fromLayerId, fromPortId, toPortId;
+    };
+
+    // Layers and edges of the network collected before the nGraph nodes are created
+    struct NetworkDescription {
+        std::map<size_t, GenericLayerParams> params;
+        std::map<size_t, std::vector<Edge>> edges;
+        std::vector<size_t> outputs;
+        std::unordered_set<std::string> names;
+
+        void addLayer(const GenericLayerParams& layerParams);
+        void addEdge(const pugi::xml_node& node);
+    };
+
+    // Creates the nodes in topological order, layerNode gives the XML node of a layer by its id
+    std::shared_ptr<ngraph::Function> createFunction(NetworkDescription& description, const std::string& name,
+                                                     const std::function<pugi::xml_node(size_t)>& layerNode,
+                                                     const Blob::CPtr& weights);
+
     GenericLayerParams parseGenericParams(const pugi::xml_node& node);
     void parsePreProcess(CNNNetwork& network, const pugi::xml_node& root, const Blob::CPtr& weights);
 
@@ -0,0 +1,147 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_xml_stream_reader.hpp"
+
+#include <details/ie_exception.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+using namespace InferenceEngine::details;
+
+namespace {
+
+std::string tagName(const std::string& markup, size_t begin) {
+    auto end = markup.find_first_of(" \t\r\n/>", begin);
+    return markup.substr(begin, end - begin);
+}
+
+bool endsWith(const std::string& str, const char* suffix) {
+    const size_t length = std::strlen(suffix);
+    return str.size() >= length && str.compare(str.size() - length, length, suffix) == 0;
+}
+
+}  // namespace
+
+XmlStreamReader::XmlStreamReader(std::istream& stream, size_t blockSize): _stream(stream), _block(blockSize) {}
+
+bool XmlStreamReader::fill() {
+    if (_pos == _size) {
+        _stream.read(_block.data(), _block.size());
+        _size = static_cast<size_t>(_stream.gcount());
+        _pos = 0;
+    }
+    return _size != 0;
+}
+
+bool XmlStreamReader::next(char& c) {
+    if (!fill())
+        return false;
+    c = _block[_pos++];
+    _offset++;
+    return true;
+}
+
+void XmlStreamReader::readMarkup(std::string& markup) {
+    // markup is started by '<', it is a tag, a comment, a CDATA section or a declaration
+    markup.assign(1, '<');
+    const char* terminator = ">";
+    char quote = 0;
+    char c;
+    while (next(c)) {
+        markup += c;
+        if (markup.size() == 2 && c == '?') {
+            terminator = "?>";
+        } else if (markup.size() == 4 && markup == "<!--") {
+            terminator = "-->";
+        } else if (markup.size() == 9 && markup == "<![CDATA[") {
+            terminator = "]]>";
+        } else if (terminator[1] != '\0') {
+            if (markup.size() > 4 && endsWith(markup, terminator))
+                return;
+        } else if (quote != 0) {
+            if (c == quote)
+                quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '>') {
+            return;
+        }
+    }
+    THROW_IE_EXCEPTION << "Unexpected end of XML stream inside of " << markup.substr(0, 32);
+}
+
+void XmlStreamReader::read(const std::function<bool(const Path&)>& collect,
+                           const std::function<void(const Path&, const std::string&, std::streamoff)>& onElement) {
+    _offset = _stream.tellg();
+    _pos = _size = 0;
+
+    Path path;
+    std::string markup, collected;
+    // depth of the element being collected, 0 if there is no such element
+    size_t collectedDepth = 0;
+    std::streamoff collectedOffset = 0;
+
+    auto closeElement = [&] {
+        if (path.size() == collectedDepth) {
+            onElement(path, collected, collectedOffset);
+            collected.clear();
+            collectedDepth = 0;
+        }
+        path.pop_back();
+    };
+
+    char c;
+    while (true) {
+        // the text up to the next markup is needed only inside of a collected element
+        if (!fill())
+            break;
+        const char* begin = _block.data() + _pos;
+        const char* end = _block.data() + _size;
+        const char* found = std::find(begin, end, '<');
+        if (collectedDepth != 0)
+            collected.append(begin, found);
+        _pos += found - begin;
+        _offset += found - begin;
+        if (found == end)
+            continue;
+
+        const std::streamoff markupOffset = _offset;
+        next(c);
+        readMarkup(markup);
+
+        if (markup[1] == '?' || markup[1] == '!') {
+            if (collectedDepth != 0)
+                collected += markup;
+            continue;
+        }
+
+        if (markup[1] == '/') {
+            auto name = tagName(markup, 2);
+            if (path.empty() || path.back() != name)
+                THROW_IE_EXCEPTION << "Unexpected end tag " << markup << " at offset " << markupOffset;
+            if (collectedDepth != 0)
+                collected += markup;
+            closeElement();
+        } else {
+            path.push_back(tagName(markup, 1));
+            const bool empty = endsWith(markup, "/>");
+            if (path.size() == 1)
+                _rootTag = empty ? markup : markup.substr(0, markup.size() - 1) + "/>";
+            if (collectedDepth == 0 && collect(path)) {
+                collectedDepth = path.size();
+                collectedOffset = markupOffset;
+            }
+            if (collectedDepth != 0)
+                collected += markup;
+            if (empty)
+                closeElement();
+        }
+        if (path.empty())
+            return;
+    }
+    THROW_IE_EXCEPTION << "Unexpected end of XML stream: " << (path.empty() ? "no root element" : "unclosed element " + path.back());
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Walks the elements of an XML stream without building its document.
+ * Only the elements selected by the caller are collected as text, so the memory used does not depend
+ * on the size of the stream.
+ */
+class XmlStreamReader {
+public:
+    /**
+     * @brief Names of the element and its ancestors starting from the root element
+     */
+    using Path = std::vector<std::string>;
+
+    explicit XmlStreamReader(std::istream& stream, size_t blockSize = 64 * 1024);
+
+    /**
+     * @brief Reads the stream up to the end of the root element
+     * @param collect Tells whether the element with the given path should be collected,
+     *        the children of a collected element are not inspected
+     * @param onElement Receives a collected element: its path, text and offset in the stream
+     */
+    void read(const std::function<bool(const Path&)>& collect,
+              const std::function<void(const Path&, const std::string&, std::streamoff)>& onElement);
+
+    /**
+     * @brief Returns the start tag of the root element written as an empty element, e.g. <net name="a" version="10"/>
+     */
+    const std::string& rootTag() const {
+        return _rootTag;
+    }
+
+private:
+    bool fill();
+    bool next(char& c);
+    void readMarkup(std::string& markup);
+
+    std::istream& _stream;
+    std::vector<char> _block;
+    size_t _pos = 0;
+    size_t _size = 0;
+    std::streamoff _offset = 0;
+    std::string _rootTag;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
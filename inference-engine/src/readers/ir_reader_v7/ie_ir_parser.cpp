@@ -23,6 +23,10 @@ std::shared_ptr<ICNNNetwork> IRParser::parse(const pugi::xml_node& root, const B
     return parser->parse(root, weights);
 }
 
+std::shared_ptr<ICNNNetwork> IRParser::parse(std::istream& model, const Blob::CPtr& weights) {
+    return parser->parse(model, weights);
+}
+
 /**
  * Hold original blob in order to avoid situations when original blob is allocated on stack
  */
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+
+class TRANSFORMATIONS_API LayerNorm : public Op {
+public:
+    static constexpr NodeTypeInfo type_info{"LayerNorm", 1};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    LayerNorm() = default;
+    /// \brief Constructs a layer normalization over the last axis:
+    /// (data - mean) / sqrt(variance + eps) * gamma + beta
+    ///
+    /// \param data The node producing the input tensor.<br>
+    /// `[D1, ... Dn, C]`
+    /// \param gamma The node producing the scales.<br>
+    /// `[C]`
+    /// \param beta The node producing the shifts.<br>
+    /// `[C]`
+    /// \param eps The value added to the variance
+    ///
+    /// Output `[D1, ... Dn, C]`
+    ///
+    LayerNorm(const Output<Node>& data,
+              const Output<Node>& gamma,
+              const Output<Node>& beta,
+              float eps);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_eps() const { return m_eps; }
+
+protected:
+    float m_eps = 0.f;
+};
+
+}  // namespace op
+}  // namespace ngraph
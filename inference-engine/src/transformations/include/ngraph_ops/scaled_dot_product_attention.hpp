@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+
+class TRANSFORMATIONS_API ScaledDotProductAttention : public Op {
+public:
+    static constexpr NodeTypeInfo type_info{"ScaledDotProductAttention", 1};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    ScaledDotProductAttention() = default;
+    /// \brief Constructs a scaled dot-product attention operation:
+    /// softmax(scale * query x key^T + mask) x value
+    ///
+    /// \param query The node producing the queries.<br>
+    /// `[B1, ... Bn, L, D]`
+    /// \param key The node producing the keys.<br>
+    /// `[B1, ... Bn, S, D]` or `[B1, ... Bn, D, S]` if key_transposed is set
+    /// \param value The node producing the values.<br>
+    /// `[B1, ... Bn, S, Dv]`
+    /// \param mask The node producing the additive mask broadcastable to `[B1, ... Bn, L, S]`
+    /// \param scale The factor applied to the products of queries and keys
+    /// \param key_transposed Whether the keys are stored transposed
+    ///
+    /// Output `[B1, ... Bn, L, Dv]`
+    ///
+    ScaledDotProductAttention(const Output<Node>& query,
+                              const Output<Node>& key,
+                              const Output<Node>& value,
+                              float scale,
+                              bool key_transposed = false);
+
+    ScaledDotProductAttention(const Output<Node>& query,
+                              const Output<Node>& key,
+                              const Output<Node>& value,
+                              const Output<Node>& mask,
+                              float scale,
+                              bool key_transposed = false);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_key_transposed() const { return m_key_transposed; }
+
+protected:
+    float m_scale = 1.f;
+    bool m_key_transposed = false;
+};
+
+}  // namespace op
+}  // namespace ngraph
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API LayerNormFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief LayerNormFusion transformation replaces a sub-graph
+ * (x - ReduceMean(x)) / Sqrt(ReduceMean((x - ReduceMean(x)) ^ 2) + eps) * gamma + beta
+ * with a LayerNorm op when the reductions are over the last axis and gamma and beta are constants.
+ * The division may also be a multiplication by Power(ReduceMean(...) + eps, -0.5).
+ */
+class ngraph::pass::LayerNormFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    LayerNormFusion();
+};
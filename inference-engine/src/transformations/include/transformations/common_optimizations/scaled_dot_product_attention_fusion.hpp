@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ScaledDotProductAttentionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ScaledDotProductAttentionFusion transformation replaces a sub-graph
+ * MatMul(Softmax(Add(Multiply(MatMul(Q, K), scale), mask)), V) with a ScaledDotProductAttention op.
+ * The scale (Multiply or Divide by a scalar constant) and the mask addition are optional.
+ */
+class ngraph::pass::ScaledDotProductAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledDotProductAttentionFusion();
+};
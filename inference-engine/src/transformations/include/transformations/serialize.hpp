@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 #include "ngraph/opsets/opset.hpp"
@@ -37,7 +38,16 @@ public:
               Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {})
         : m_xmlPath{xmlPath}, m_binPath{binPath}, m_version{version}, m_custom_opsets{custom_opsets} {}
 
+    /**
+     * @brief Writes IR into the given streams instead of files; streams must outlive the pass
+     */
+    Serialize(std::ostream& xmlFile, std::ostream& binFile,
+              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {})
+        : m_xmlFile{&xmlFile}, m_binFile{&binFile}, m_version{version}, m_custom_opsets{custom_opsets} {}
+
 private:
+    std::ostream* m_xmlFile = nullptr;
+    std::ostream* m_binFile = nullptr;
     const std::string m_xmlPath;
     const std::string m_binPath;
     const Version m_version;
@@ -0,0 +1,57 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_ops/layer_norm.hpp"
+
+#include <memory>
+
+#include "ngraph/validation_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::LayerNorm::type_info;
+
+op::LayerNorm::LayerNorm(const Output<Node>& data,
+                         const Output<Node>& gamma,
+                         const Output<Node>& beta,
+                         float eps)
+        : Op({data, gamma, beta})
+        , m_eps(eps) {
+    constructor_validate_and_infer_types();
+}
+
+void op::LayerNorm::validate_and_infer_types() {
+    const auto& data_shape = get_input_partial_shape(0);
+    const auto element_type = get_input_element_type(0);
+
+    for (size_t i = 1; i < get_input_size(); i++) {
+        NODE_VALIDATION_CHECK(this, element_type.compatible(get_input_element_type(i)),
+                              "Input ", i, " element type (", get_input_element_type(i),
+                              ") does not match the data element type (", element_type, ").");
+
+        const auto& shape = get_input_partial_shape(i);
+        NODE_VALIDATION_CHECK(this, shape.rank().compatible(1), "Input ", i, " must be 1D, got ", shape, ".");
+        if (data_shape.rank().is_static() && shape.rank().is_static()) {
+            const auto& channels = data_shape[data_shape.rank().get_length() - 1];
+            NODE_VALIDATION_CHECK(this, shape[0].compatible(channels),
+                                  "Input ", i, " size ", shape[0], " does not match the normalized dimension ", channels, ".");
+        }
+    }
+
+    NODE_VALIDATION_CHECK(this, data_shape.rank().is_dynamic() || data_shape.rank().get_length() >= 1,
+                          "Data must not be a scalar.");
+
+    set_output_type(0, element_type, data_shape);
+}
+
+bool op::LayerNorm::visit_attributes(AttributeVisitor& visitor) {
+    visitor.on_attribute("eps", m_eps);
+    return true;
+}
+
+shared_ptr<Node> op::LayerNorm::clone_with_new_inputs(const OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return make_shared<LayerNorm>(new_args.at(0), new_args.at(1), new_args.at(2), m_eps);
+}
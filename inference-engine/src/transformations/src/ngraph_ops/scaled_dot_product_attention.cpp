@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_ops/scaled_dot_product_attention.hpp"
+
+#include <memory>
+
+#include "ngraph/validation_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ScaledDotProductAttention::type_info;
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                         const Output<Node>& key,
+                                                         const Output<Node>& value,
+                                                         float scale,
+                                                         bool key_transposed)
+        : Op({query, key, value})
+        , m_scale(scale)
+        , m_key_transposed(key_transposed) {
+    constructor_validate_and_infer_types();
+}
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                         const Output<Node>& key,
+                                                         const Output<Node>& value,
+                                                         const Output<Node>& mask,
+                                                         float scale,
+                                                         bool key_transposed)
+        : Op({query, key, value, mask})
+        , m_scale(scale)
+        , m_key_transposed(key_transposed) {
+    constructor_validate_and_infer_types();
+}
+
+void op::ScaledDotProductAttention::validate_and_infer_types() {
+    const auto& query_shape = get_input_partial_shape(0);
+    const auto& key_shape = get_input_partial_shape(1);
+    const auto& value_shape = get_input_partial_shape(2);
+    const auto element_type = get_input_element_type(0);
+
+    for (size_t i = 1; i < get_input_size(); i++) {
+        NODE_VALIDATION_CHECK(this, element_type.compatible(get_input_element_type(i)),
+                              "Input ", i, " element type (", get_input_element_type(i),
+                              ") does not match the query element type (", element_type, ").");
+    }
+
+    if (query_shape.rank().is_dynamic() || key_shape.rank().is_dynamic() || value_shape.rank().is_dynamic()) {
+        set_output_type(0, element_type, PartialShape::dynamic());
+        return;
+    }
+
+    const auto rank = query_shape.rank().get_length();
+    NODE_VALIDATION_CHECK(this, rank >= 2, "Query rank must be at least 2, got ", rank, ".");
+    NODE_VALIDATION_CHECK(this, key_shape.rank().get_length() == rank && value_shape.rank().get_length() == rank,
+                          "Query, key and value must have the same rank.");
+
+    const auto depth_axis = m_key_transposed ? rank - 2 : rank - 1;
+    const auto length_axis = m_key_transposed ? rank - 1 : rank - 2;
+    NODE_VALIDATION_CHECK(this, query_shape[rank - 1].compatible(key_shape[depth_axis]),
+                          "Query depth ", query_shape[rank - 1], " does not match key depth ", key_shape[depth_axis], ".");
+    NODE_VALIDATION_CHECK(this, key_shape[length_axis].compatible(value_shape[rank - 2]),
+                          "Key length ", key_shape[length_axis], " does not match value length ", value_shape[rank - 2], ".");
+
+    if (get_input_size() == 4) {
+        const auto& mask_shape = get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(this, mask_shape.rank().is_dynamic() || mask_shape.rank().get_length() <= rank,
+                              "Mask rank must not exceed the query rank.");
+    }
+
+    PartialShape output_shape = query_shape;
+    output_shape[rank - 1] = value_shape[rank - 1];
+    set_output_type(0, element_type, output_shape);
+}
+
+bool op::ScaledDotProductAttention::visit_attributes(AttributeVisitor& visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("key_transposed", m_key_transposed);
+    return true;
+}
+
+shared_ptr<Node> op::ScaledDotProductAttention::clone_with_new_inputs(const OutputVector& new_args) const {
+    if (new_args.size() == 3) {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                      m_scale, m_key_transposed);
+    } else if (new_args.size() == 4) {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                      m_scale, m_key_transposed);
+    }
+
+    throw ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+}
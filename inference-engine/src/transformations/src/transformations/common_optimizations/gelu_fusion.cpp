@@ -0,0 +1,153 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/gelu_fusion.hpp"
+
+#include <cmath>
+#include <memory>
+
+#include <ngraph/opsets/opset2.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::GeluFusion, "GeluFusion", 0);
+
+namespace {
+
+bool is_constant_equal_to(const ngraph::Output<ngraph::Node>& output, float value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset2::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1 || !constant->get_element_type().is_real())
+        return false;
+    return std::fabs(constant->cast_vector<float>()[0] - value) < 1e-4f * std::fabs(value);
+}
+
+// checks that the argument of Erf is x / sqrt(2) or x * (1 / sqrt(2))
+bool is_erf_argument(const std::shared_ptr<ngraph::Node>& erf, const ngraph::Output<ngraph::Node>& x) {
+    auto arg = erf->get_input_node_shared_ptr(0);
+    if (arg->get_input_size() != 2 || arg->output(0).get_target_inputs().size() != 1)
+        return false;
+
+    if (ngraph::is_type<ngraph::opset2::Divide>(arg))
+        return arg->input_value(0) == x && is_constant_equal_to(arg->input_value(1), std::sqrt(2.f));
+
+    if (ngraph::is_type<ngraph::opset2::Multiply>(arg)) {
+        for (size_t i = 0; i < 2; i++) {
+            if (arg->input_value(i) == x && is_constant_equal_to(arg->input_value(1 - i), 1.f / std::sqrt(2.f)))
+                return true;
+        }
+    }
+    return false;
+}
+
+bool fuse_gelu(const ngraph::Output<ngraph::Node>& x, const std::shared_ptr<ngraph::Node>& erf,
+               const ngraph::NodeVector& nodes, const std::shared_ptr<ngraph::Node>& root) {
+    if (!x.get_element_type().is_real() || !is_erf_argument(erf, x))
+        return false;
+    // single element constants of a greater rank broadcast the result to a shape Gelu(x) doesn't have
+    if (x.get_partial_shape() != root->get_output_partial_shape(0) ||
+            x.get_element_type() != root->get_output_element_type(0))
+        return false;
+    for (const auto& node : nodes) {
+        if (node != root && node->output(0).get_target_inputs().size() != 1)
+            return false;
+    }
+
+    auto gelu = std::make_shared<ngraph::opset2::Gelu>(x);
+
+    ngraph::NodeVector fused_nodes = nodes;
+    fused_nodes.push_back(erf->get_input_node_shared_ptr(0));
+    gelu->set_friendly_name(root->get_friendly_name());
+    ngraph::copy_runtime_info(fused_nodes, gelu);
+    ngraph::replace_node(root, gelu);
+    return true;
+}
+
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::GeluFusionWithErfOne, "GeluFusionWithErfOne", 0);
+
+ngraph::pass::GeluFusionWithErfOne::GeluFusionWithErfOne() {
+    // replaces a sub-graph (0.5 * x) * (1 + erf(x / sqrt(2))) with a Gelu op.
+    auto input = ngraph::pattern::any_input();
+    auto erf = ngraph::pattern::wrap_type<ngraph::opset2::Erf>({ngraph::pattern::any_input()});
+    auto one = ngraph::pattern::wrap_type<ngraph::opset2::Constant>();
+    auto add = ngraph::pattern::wrap_type<ngraph::opset2::Add>({erf, one});
+    auto half = ngraph::pattern::wrap_type<ngraph::opset2::Constant>();
+    auto mul_half = ngraph::pattern::wrap_type<ngraph::opset2::Multiply>({input, half});
+    auto mul = ngraph::pattern::wrap_type<ngraph::opset2::Multiply>({mul_half, add});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto &pattern_to_output = m.get_pattern_value_map();
+        if (!is_constant_equal_to(pattern_to_output.at(one), 1.f) || !is_constant_equal_to(pattern_to_output.at(half), 0.5f))
+            return false;
+
+        return fuse_gelu(pattern_to_output.at(input), pattern_to_output.at(erf).get_node_shared_ptr(),
+                         {pattern_to_output.at(erf).get_node_shared_ptr(),
+                          pattern_to_output.at(add).get_node_shared_ptr(),
+                          pattern_to_output.at(mul_half).get_node_shared_ptr(),
+                          pattern_to_output.at(mul).get_node_shared_ptr()},
+                         m.get_match_root());
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(mul, "GeluFusionWithErfOne");
+    register_matcher(m, callback);
+}
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::GeluFusionWithErfTwo, "GeluFusionWithErfTwo", 0);
+
+ngraph::pass::GeluFusionWithErfTwo::GeluFusionWithErfTwo() {
+    // replaces a sub-graph 0.5 * (x * (1 + erf(x / sqrt(2)))) with a Gelu op.
+    auto input = ngraph::pattern::any_input();
+    auto erf = ngraph::pattern::wrap_type<ngraph::opset2::Erf>({ngraph::pattern::any_input()});
+    auto one = ngraph::pattern::wrap_type<ngraph::opset2::Constant>();
+    auto add = ngraph::pattern::wrap_type<ngraph::opset2::Add>({erf, one});
+    auto mul_input = ngraph::pattern::wrap_type<ngraph::opset2::Multiply>({input, add});
+    auto half = ngraph::pattern::wrap_type<ngraph::opset2::Constant>();
+    auto mul = ngraph::pattern::wrap_type<ngraph::opset2::Multiply>({mul_input, half});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto &pattern_to_output = m.get_pattern_value_map();
+        if (!is_constant_equal_to(pattern_to_output.at(one), 1.f) || !is_constant_equal_to(pattern_to_output.at(half), 0.5f))
+            return false;
+
+        return fuse_gelu(pattern_to_output.at(input), pattern_to_output.at(erf).get_node_shared_ptr(),
+                         {pattern_to_output.at(erf).get_node_shared_ptr(),
+                          pattern_to_output.at(add).get_node_shared_ptr(),
+                          pattern_to_output.at(mul_input).get_node_shared_ptr(),
+                          pattern_to_output.at(mul).get_node_shared_ptr()},
+                         m.get_match_root());
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(mul, "GeluFusionWithErfTwo");
+    register_matcher(m, callback);
+}
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::GeluFusionWithErfThree, "GeluFusionWithErfThree", 0);
+
+ngraph::pass::GeluFusionWithErfThree::GeluFusionWithErfThree() {
+    // replaces a sub-graph x * (0.5 * (1 + erf(x / sqrt(2)))) with a Gelu op.
+    auto input = ngraph::pattern::any_input();
+    auto erf = ngraph::pattern::wrap_type<ngraph::opset2::Erf>({ngraph::pattern::any_input()});
+    auto one = ngraph::pattern::wrap_type<ngraph::opset2::Constant>();
+    auto add = ngraph::pattern::wrap_type<ngraph::opset2::Add>({erf, one});
+    auto half = ngraph::pattern::wrap_type<ngraph::opset2::Constant>();
+    auto mul_half = ngraph::pattern::wrap_type<ngraph::opset2::Multiply>({add, half});
+    auto mul = ngraph::pattern::wrap_type<ngraph::opset2::Multiply>({input, mul_half});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto &pattern_to_output = m.get_pattern_value_map();
+        if (!is_constant_equal_to(pattern_to_output.at(one), 1.f) || !is_constant_equal_to(pattern_to_output.at(half), 0.5f))
+            return false;
+
+        return fuse_gelu(pattern_to_output.at(input), pattern_to_output.at(erf).get_node_shared_ptr(),
+                         {pattern_to_output.at(erf).get_node_shared_ptr(),
+                          pattern_to_output.at(add).get_node_shared_ptr(),
+                          pattern_to_output.at(mul_half).get_node_shared_ptr(),
+                          pattern_to_output.at(mul).get_node_shared_ptr()},
+                         m.get_match_root());
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(mul, "GeluFusionWithErfThree");
+    register_matcher(m, callback);
+}
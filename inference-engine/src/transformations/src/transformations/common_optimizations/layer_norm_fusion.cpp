@@ -0,0 +1,173 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/layer_norm_fusion.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph_ops/layer_norm.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::LayerNormFusion, "LayerNormFusion", 0);
+
+namespace {
+
+bool get_scalar_constant(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// checks that the node is a ReduceMean over the last axis which keeps the reduced dimension
+bool is_last_axis_mean(const std::shared_ptr<ngraph::opset1::ReduceMean>& mean, size_t rank) {
+    if (!mean || !mean->get_keep_dims())
+        return false;
+    auto axes = std::dynamic_pointer_cast<ngraph::opset1::Constant>(mean->get_input_node_shared_ptr(1));
+    if (!axes)
+        return false;
+    auto axes_values = axes->cast_vector<int64_t>();
+    if (axes_values.size() != 1)
+        return false;
+    const auto axis = axes_values[0] < 0 ? axes_values[0] + static_cast<int64_t>(rank) : axes_values[0];
+    return axis == static_cast<int64_t>(rank) - 1;
+}
+
+// returns a 1D constant of the given size if the constant is a scalar or is broadcast along the last axis only
+std::shared_ptr<ngraph::Node> get_channel_constant(const ngraph::Output<ngraph::Node>& output, const ngraph::element::Type& type,
+                                                   size_t channels, size_t rank) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant)
+        return nullptr;
+    const auto& shape = constant->get_shape();
+    const auto size = ngraph::shape_size(shape);
+    if (shape.size() > rank || (size != channels && size != 1) ||
+        std::any_of(shape.begin(), shape.end() - std::min<size_t>(shape.size(), 1), [](size_t dim) { return dim != 1; }))
+        return nullptr;
+
+    auto values = constant->cast_vector<float>();
+    values.resize(channels, values[0]);
+    return ngraph::opset1::Constant::create(type, ngraph::Shape{channels}, values);
+}
+
+}  // namespace
+
+ngraph::pass::LayerNormFusion::LayerNormFusion() {
+    auto norm = ngraph::pattern::any_input();
+    auto gamma = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto beta = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto mul_gamma = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({norm, gamma}, ngraph::pattern::consumers_count(1));
+    auto add_beta = ngraph::pattern::wrap_type<ngraph::opset1::Add>({mul_gamma, beta}, ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto add_beta_node = pattern_to_output.at(add_beta).get_node_shared_ptr();
+        auto norm_node = pattern_to_output.at(norm).get_node_shared_ptr();
+        ngraph::NodeVector fused_nodes{add_beta_node, pattern_to_output.at(mul_gamma).get_node_shared_ptr(), norm_node};
+
+        // (x - mean) / Sqrt(variance + eps) or (x - mean) * Power(variance + eps, -0.5)
+        ngraph::Output<ngraph::Node> centered;
+        std::shared_ptr<ngraph::Node> variance_eps;
+        if (ngraph::is_type<ngraph::opset1::Divide>(norm_node)) {
+            auto sqrt = std::dynamic_pointer_cast<ngraph::opset1::Sqrt>(norm_node->get_input_node_shared_ptr(1));
+            if (!sqrt)
+                return false;
+            centered = norm_node->input_value(0);
+            variance_eps = sqrt->get_input_node_shared_ptr(0);
+            fused_nodes.push_back(sqrt);
+        } else if (ngraph::is_type<ngraph::opset1::Multiply>(norm_node)) {
+            for (size_t i = 0; i < 2 && !variance_eps; i++) {
+                auto power = std::dynamic_pointer_cast<ngraph::opset1::Power>(norm_node->get_input_node_shared_ptr(i));
+                float exponent = 0.f;
+                if (power && get_scalar_constant(power->input_value(1), exponent) && exponent == -0.5f) {
+                    centered = norm_node->input_value(1 - i);
+                    variance_eps = power->get_input_node_shared_ptr(0);
+                    fused_nodes.push_back(power);
+                }
+            }
+            if (!variance_eps)
+                return false;
+        } else {
+            return false;
+        }
+
+        auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(centered.get_node_shared_ptr());
+        if (!subtract)
+            return false;
+        auto data = subtract->input_value(0);
+        if (data.get_partial_shape().is_dynamic() || data.get_shape().empty() || !data.get_element_type().is_real() ||
+            data.get_shape() != add_beta_node->get_output_shape(0))
+            return false;
+        const auto rank = data.get_shape().size();
+        auto mean = std::dynamic_pointer_cast<ngraph::opset1::ReduceMean>(subtract->get_input_node_shared_ptr(1));
+        if (!is_last_axis_mean(mean, rank) || mean->input_value(0) != data)
+            return false;
+        fused_nodes.push_back(subtract);
+        fused_nodes.push_back(mean);
+
+        // ReduceMean(Power(x - mean, 2)) + eps, the squared difference may also be a Multiply of x - mean by itself
+        float eps = 0.f;
+        std::shared_ptr<ngraph::opset1::ReduceMean> variance;
+        if (!ngraph::is_type<ngraph::opset1::Add>(variance_eps))
+            return false;
+        for (size_t i = 0; i < 2 && !variance; i++) {
+            if (get_scalar_constant(variance_eps->input_value(i), eps))
+                variance = std::dynamic_pointer_cast<ngraph::opset1::ReduceMean>(variance_eps->get_input_node_shared_ptr(1 - i));
+        }
+        if (!is_last_axis_mean(variance, rank) || eps < 0.f)
+            return false;
+        fused_nodes.push_back(variance_eps);
+        fused_nodes.push_back(variance);
+
+        auto square = variance->get_input_node_shared_ptr(0);
+        ngraph::Output<ngraph::Node> squared_centered;
+        float exponent = 0.f;
+        if (ngraph::is_type<ngraph::opset1::Power>(square) && get_scalar_constant(square->input_value(1), exponent) && exponent == 2.f) {
+            squared_centered = square->input_value(0);
+        } else if (ngraph::is_type<ngraph::opset1::Multiply>(square) && square->input_value(0) == square->input_value(1)) {
+            squared_centered = square->input_value(0);
+        } else {
+            return false;
+        }
+        fused_nodes.push_back(square);
+        if (squared_centered != centered) {
+            auto squared_subtract = squared_centered.get_node_shared_ptr();
+            if (!ngraph::is_type<ngraph::opset1::Subtract>(squared_subtract) || squared_subtract->input_value(0) != data ||
+                squared_subtract->input_value(1) != mean->output(0))
+                return false;
+            fused_nodes.push_back(squared_subtract);
+        }
+
+        // the intermediate results must not be used outside of the sub-graph
+        for (const auto& node : fused_nodes) {
+            if (node == add_beta_node)
+                continue;
+            for (const auto& consumer : node->output(0).get_target_inputs()) {
+                if (std::find(fused_nodes.begin(), fused_nodes.end(), consumer.get_node()->shared_from_this()) == fused_nodes.end())
+                    return false;
+            }
+        }
+
+        const auto channels = data.get_shape().back();
+        auto gamma_node = get_channel_constant(pattern_to_output.at(gamma), data.get_element_type(), channels, rank);
+        auto beta_node = get_channel_constant(pattern_to_output.at(beta), data.get_element_type(), channels, rank);
+        if (!gamma_node || !beta_node)
+            return false;
+
+        auto layer_norm = std::make_shared<ngraph::op::LayerNorm>(data, gamma_node, beta_node, eps);
+
+        layer_norm->set_friendly_name(add_beta_node->get_friendly_name());
+        ngraph::copy_runtime_info(fused_nodes, layer_norm);
+        ngraph::replace_node(add_beta_node, layer_norm);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(add_beta, "LayerNormFusion");
+    register_matcher(m, callback);
+}
@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph_ops/scaled_dot_product_attention.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+
+bool has_single_consumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->output(0).get_target_inputs().size() == 1;
+}
+
+// returns the scalar value of a constant input of the node, the other input is stored to data
+bool get_scalar_input(const std::shared_ptr<ngraph::Node>& node, bool commutative, ngraph::Output<ngraph::Node>& data, float& value) {
+    for (size_t i = 0; i < 2; i++) {
+        if (i == 0 && !commutative)
+            continue;
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(i));
+        if (constant && ngraph::shape_size(constant->get_shape()) == 1) {
+            value = constant->cast_vector<float>()[0];
+            data = node->input_value(1 - i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// returns MatMul(Q, K) optionally scaled by a Multiply or a Divide with a scalar constant
+std::shared_ptr<ngraph::opset1::MatMul> get_scaled_product(ngraph::Output<ngraph::Node> scores, ngraph::NodeVector& nodes, float& scale) {
+    scale = 1.f;
+    auto scale_node = scores.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Multiply>(scale_node) || ngraph::is_type<ngraph::opset1::Divide>(scale_node)) {
+        const bool is_divide = ngraph::is_type<ngraph::opset1::Divide>(scale_node);
+        if (!has_single_consumer(scale_node) || !get_scalar_input(scale_node, !is_divide, scores, scale))
+            return nullptr;
+        if (is_divide) {
+            if (scale == 0.f)
+                return nullptr;
+            scale = 1.f / scale;
+        }
+        nodes.push_back(scale_node);
+    }
+
+    auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(scores.get_node_shared_ptr());
+    if (!matmul || !has_single_consumer(matmul) || matmul->get_transpose_a())
+        return nullptr;
+    nodes.push_back(matmul);
+    return matmul;
+}
+
+}  // namespace
+
+ngraph::pass::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>(ngraph::pattern::consumers_count(1));
+    auto value = ngraph::pattern::any_input();
+    auto matmul_value = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, value}, ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmul_v = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output.at(matmul_value).get_node_shared_ptr());
+        auto softmax_node = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(pattern_to_output.at(softmax).get_node_shared_ptr());
+        if (!matmul_v || !softmax_node || matmul_v->get_transpose_a() || matmul_v->get_transpose_b())
+            return false;
+
+        const auto rank = matmul_v->get_output_shape(0).size();
+        if (rank < 2 || softmax_node->get_axis() != rank - 1)
+            return false;
+
+        ngraph::NodeVector fused_nodes{matmul_v, softmax_node};
+        ngraph::Output<ngraph::Node> scores = softmax_node->input_value(0);
+
+        // optional additive mask, either operand may be the scores
+        ngraph::Output<ngraph::Node> mask;
+        ngraph::NodeVector scores_nodes;
+        float scale = 1.f;
+        std::shared_ptr<ngraph::opset1::MatMul> matmul_qk;
+        if (auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(scores.get_node_shared_ptr())) {
+            if (!has_single_consumer(add))
+                return false;
+            for (size_t i = 0; i < 2 && !matmul_qk; i++) {
+                scores_nodes.clear();
+                matmul_qk = get_scaled_product(add->input_value(i), scores_nodes, scale);
+                mask = add->input_value(1 - i);
+            }
+            if (!matmul_qk || add->get_output_shape(0) != matmul_qk->get_output_shape(0) ||
+                mask.get_partial_shape().is_dynamic() || mask.get_shape().size() > rank)
+                return false;
+            fused_nodes.push_back(add);
+        } else {
+            matmul_qk = get_scaled_product(scores, scores_nodes, scale);
+            if (!matmul_qk)
+                return false;
+        }
+        fused_nodes.insert(fused_nodes.end(), scores_nodes.begin(), scores_nodes.end());
+
+        auto query = matmul_qk->input_value(0);
+        auto key = matmul_qk->input_value(1);
+        auto value_input = matmul_v->input_value(1);
+        for (const auto& input : {query, key, value_input}) {
+            if (input.get_partial_shape().is_dynamic() || input.get_shape().size() != rank ||
+                !input.get_element_type().is_real())
+                return false;
+        }
+        // the batch dimensions must not be broadcast
+        const auto& output_shape = matmul_v->get_output_shape(0);
+        for (size_t i = 0; i + 2 < rank; i++) {
+            if (query.get_shape()[i] != output_shape[i] || key.get_shape()[i] != output_shape[i] ||
+                value_input.get_shape()[i] != output_shape[i])
+                return false;
+        }
+
+        const bool key_transposed = !matmul_qk->get_transpose_b();
+        std::shared_ptr<ngraph::Node> attention;
+        if (mask.get_node()) {
+            attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(query, key, value_input, mask, scale, key_transposed);
+        } else {
+            attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(query, key, value_input, scale, key_transposed);
+        }
+
+        attention->set_friendly_name(matmul_v->get_friendly_name());
+        ngraph::copy_runtime_info(fused_nodes, attention);
+        ngraph::replace_node(matmul_v, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_value, "ScaledDotProductAttentionFusion");
+    register_matcher(m, callback);
+}
@@ -492,14 +492,20 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
         break;
     }
 
-    // create xml file
-    std::ofstream xml_file(m_xmlPath, std::ios::out);
-    xml_doc.save(xml_file);
-
-    // create bin file
-    std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
-    bin_file.write(reinterpret_cast<const char*>(constants.data()),
-                   constants.size() * sizeof(constants[0]));
+    if (m_xmlFile && m_binFile) {
+        xml_doc.save(*m_xmlFile);
+        m_binFile->write(reinterpret_cast<const char*>(constants.data()),
+                         constants.size() * sizeof(constants[0]));
+    } else {
+        // create xml file
+        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        xml_doc.save(xml_file);
+
+        // create bin file
+        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        bin_file.write(reinterpret_cast<const char*>(constants.data()),
+                       constants.size() * sizeof(constants[0]));
+    }
 
     // Return false because we didn't change nGraph Function
     return false;
@@ -0,0 +1,169 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <file_utils.h>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include "details/ie_so_loader.h"
+
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <common_test_utils/file_utils.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+
+const char cachedModel[] = "cached model";
+
+class CachingTestExecutableNetwork : public ExecutableNetworkInternal {
+public:
+    IInferRequest::Ptr CreateInferRequest() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+protected:
+    void ExportImpl(std::ostream& networkModel) override {
+        networkModel << cachedModel;
+    }
+};
+
+/**
+ * @brief A plugin which counts how many networks are compiled and imported, Core gets it through mock_engine
+ */
+class CachingTestPlugin : public InferencePluginInternal {
+public:
+    std::atomic<int> loadCount{0};
+    std::atomic<int> importCount{0};
+
+    void SetConfig(const std::map<std::string, std::string>&) override {}
+
+    Parameter GetMetric(const std::string& name, const std::map<std::string, Parameter>&) const override {
+        if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+            return true;
+        } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+            return std::vector<std::string>{};
+        }
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+protected:
+    ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const CNNNetwork&,
+                                                      const std::map<std::string, std::string>&) override {
+        loadCount++;
+        return std::make_shared<CachingTestExecutableNetwork>();
+    }
+
+    ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                        const std::map<std::string, std::string>&) override {
+        std::string model;
+        std::getline(networkModel, model);
+        if (model != cachedModel) {
+            THROW_IE_EXCEPTION << "Unexpected cached model: " << model;
+        }
+        importCount++;
+        auto impl = std::make_shared<CachingTestExecutableNetwork>();
+        impl->SetPointerToPlugin(shared_from_this());
+        return ExecutableNetwork(make_executable_network(impl));
+    }
+};
+
+}  // namespace
+
+class CachingTest : public ::testing::Test {
+protected:
+    const std::string deviceName = "CACHING_MOCK";
+    const std::string cacheDir = "caching_test_cache";
+    std::shared_ptr<CachingTestPlugin> plugin;
+    std::unique_ptr<details::SharedObjectLoader> mockEngine;
+    std::unique_ptr<Core> ie;
+
+    void SetUp() override {
+        auto libraryName = FileUtils::makeSharedLibraryName<char>(getIELibraryPath(),
+            std::string("mock_engine") + IE_BUILD_POSTFIX);
+        mockEngine.reset(new details::SharedObjectLoader(libraryName.c_str()));
+        plugin = std::make_shared<CachingTestPlugin>();
+        auto injectProxyEngine = reinterpret_cast<void(*)(IInferencePlugin*)>(
+            mockEngine->get_symbol("InjectProxyEngine"));
+        injectProxyEngine(plugin.get());
+
+        ie.reset(new Core);
+        ie->RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, deviceName);
+    }
+
+    void TearDown() override {
+        ie.reset();
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+};
+
+TEST_F(CachingTest, secondLoadNetworkImportsFromCache) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    std::map<std::string, std::string> config = {{CONFIG_KEY(CACHE_DIR), cacheDir}};
+
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName, config));
+    ASSERT_EQ(1, plugin->loadCount);
+    ASSERT_EQ(0, plugin->importCount);
+    ASSERT_EQ(0, CommonTestUtils::removeFilesWithExt(cacheDir, "tmp"));
+
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName, config));
+    ASSERT_EQ(1, plugin->loadCount);
+    ASSERT_EQ(1, plugin->importCount);
+}
+
+TEST_F(CachingTest, cacheDirSetViaSetConfig) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    ie->SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}, deviceName);
+
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName));
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName));
+    ASSERT_EQ(1, plugin->loadCount);
+    ASSERT_EQ(1, plugin->importCount);
+}
+
+TEST_F(CachingTest, changedNetworkIsCompiledAgain) {
+    std::map<std::string, std::string> config = {{CONFIG_KEY(CACHE_DIR), cacheDir}};
+
+    ASSERT_NO_THROW(ie->LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()), deviceName, config));
+    ASSERT_NO_THROW(ie->LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu({1, 1, 16, 32})),
+                                    deviceName, config));
+    ASSERT_EQ(2, plugin->loadCount);
+    ASSERT_EQ(0, plugin->importCount);
+}
+
+TEST_F(CachingTest, noCacheWithoutCacheDir) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName));
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName));
+    ASSERT_EQ(2, plugin->loadCount);
+    ASSERT_EQ(0, plugin->importCount);
+}
+
+TEST_F(CachingTest, nestedCacheDirIsCreated) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    const auto nestedDir = FileUtils::makePath(FileUtils::makePath(cacheDir, std::string("nested")), std::string("dir"));
+    std::map<std::string, std::string> config = {{CONFIG_KEY(CACHE_DIR), nestedDir}};
+
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName, config));
+    ASSERT_TRUE(CommonTestUtils::directoryExists(nestedDir));
+    ASSERT_NO_THROW(ie->LoadNetwork(network, deviceName, config));
+    ASSERT_EQ(1, plugin->loadCount);
+    ASSERT_EQ(1, plugin->importCount);
+
+    CommonTestUtils::removeFilesWithExt(nestedDir, "blob");
+    CommonTestUtils::removeDir(nestedDir);
+    CommonTestUtils::removeDir(FileUtils::makePath(cacheDir, std::string("nested")));
+}
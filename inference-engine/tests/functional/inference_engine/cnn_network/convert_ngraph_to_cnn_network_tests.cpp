@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <cmath>
+
 #include <cpp/ie_cnn_network.h>
 #include <legacy/cnn_network_impl.hpp>  // deprecated API
 
@@ -19,8 +21,10 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph_ops/convolution_ie.hpp>
+#include <ngraph_ops/scaled_dot_product_attention.hpp>
 #include <transformations/init_node_info.hpp>
 #include <legacy/convert_function_to_cnn_network.hpp>
+#include "common_test_utils/common_utils.hpp"
 
 using namespace testing;
 using namespace InferenceEngine;
@@ -391,4 +395,26 @@ TEST(ConvertFunctionToCNNNetworkTests, NonUniqueNamesParametersNegative) {
     } catch(InferenceEngine::details::InferenceEngineException & e) {
         EXPECT_THAT(e.what(), testing::HasSubstr(std::string("Detected two output operations with the same name:")));
     }
-}
\ No newline at end of file
+}
+TEST(ConvertFunctionToCNNNetworkTests, ConvertScaledDotProductAttentionKeepsScale) {
+    const float scale = 1.f / std::sqrt(96.f);
+    std::shared_ptr<ngraph::Function> f;
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2, 4, 96});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2, 4, 96});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2, 4, 96});
+        auto attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(query, key, value, scale);
+        attention->set_friendly_name("attention");
+        auto result = std::make_shared<ngraph::op::Result>(attention);
+
+        f = std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                               ngraph::ParameterVector{query, key, value});
+    }
+
+    InferenceEngine::CNNNetwork nGraphImpl(f);
+    auto net = std::make_shared<InferenceEngine::details::CNNNetworkImpl>(
+        static_cast<const InferenceEngine::ICNNNetwork &>(nGraphImpl));
+    auto layer = CommonTestUtils::getLayerByName(net.get(), "attention");
+    ASSERT_NE(nullptr, layer);
+    ASSERT_EQ(scale, layer->GetParamAsFloat("scale"));
+}
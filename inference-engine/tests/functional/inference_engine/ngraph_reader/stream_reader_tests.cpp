@@ -0,0 +1,156 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <sstream>
+
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ngraph_reader_tests.hpp"
+
+TEST_F(NGraphReaderTests, ReadNetworkWithMarkupInCommentsAndAttributes) {
+    std::string model = R"V0G0N(<?xml version="1.0" ?>
+<!-- <net name="Comment" version="10"> -->
+<net name="Network" version="10">
+    <layers>
+        <!-- <layer id="5" name="commented" type="ReLU" version="opset1"/> -->
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="act/>ivation" id="1" type="ReLU" version="opset1">
+            <!-- </layer> -->
+            <input>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name='in>1' type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+        <!-- <edge from-layer="5" from-port="0" to-layer="2" to-port="0"/> -->
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    auto function = ie.ReadNetwork(model, Blob::CPtr()).getFunction();
+    ASSERT_NE(nullptr, function);
+    ASSERT_EQ("Network", function->get_friendly_name());
+
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    auto reference = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+    auto res = compare_functions(function, reference);
+    ASSERT_TRUE(res.first) << res.second;
+
+    ASSERT_EQ("in>1", function->get_parameters()[0]->get_friendly_name());
+    ASSERT_EQ("act/>ivation", function->get_results()[0]->input_value(0).get_node()->get_friendly_name());
+}
+
+TEST_F(NGraphReaderTests, ReadNetworkWithUnclosedElement) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer name="in1" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+    </layers>
+</net>
+)V0G0N";
+
+    Core ie;
+    ASSERT_THROW(ie.ReadNetwork(model, Blob::CPtr()), InferenceEngine::details::InferenceEngineException);
+}
+
+namespace {
+
+// Parameter followed by a chain of Add operations with constants
+std::string makeChainModel(size_t numAdds) {
+    const std::string port = R"(<port id="PORT" precision="FP32"><dim>1</dim><dim>16</dim></port>)";
+    auto makePort = [&port](size_t id) {
+        auto text = port;
+        return text.replace(text.find("PORT"), 4, std::to_string(id));
+    };
+
+    std::stringstream layers, edges;
+    layers << R"(<layer id="0" name="input" type="Parameter" version="opset1"><data element_type="f32" shape="1,16"/>)"
+           << "<output>" << makePort(0) << "</output></layer>\n";
+    for (size_t i = 0; i < numAdds; i++) {
+        const size_t constId = 2 * i + 1, addId = 2 * i + 2;
+        layers << "<layer id=\"" << constId << "\" name=\"const_" << i << "\" type=\"Const\" version=\"opset1\">"
+               << R"(<data element_type="f32" offset="0" shape="1,16" size="64"/>)"
+               << "<output>" << makePort(0) << "</output></layer>\n"
+               << "<layer id=\"" << addId << "\" name=\"add_" << i << "\" type=\"Add\" version=\"opset1\">"
+               << "<input>" << makePort(0) << makePort(1) << "</input><output>" << makePort(2) << "</output></layer>\n";
+        edges << "<edge from-layer=\"" << addId - 2 << "\" from-port=\"" << (i == 0 ? 0 : 2)
+              << "\" to-layer=\"" << addId << "\" to-port=\"0\"/>\n"
+              << "<edge from-layer=\"" << constId << "\" from-port=\"0\" to-layer=\"" << addId << "\" to-port=\"1\"/>\n";
+    }
+    const size_t resultId = 2 * numAdds + 1;
+    layers << "<layer id=\"" << resultId << R"(" name="output" type="Result" version="opset1"><input>)"
+           << makePort(0) << "</input></layer>\n";
+    edges << "<edge from-layer=\"" << resultId - 1 << "\" from-port=\"2\" to-layer=\"" << resultId << "\" to-port=\"0\"/>\n";
+
+    return "<net name=\"Chain\" version=\"10\">\n<layers>\n" + layers.str() + "</layers>\n<edges>\n" + edges.str() +
+           "</edges>\n</net>\n";
+}
+
+}  // namespace
+
+// Layers are created only after all edges are read, in topological order
+TEST_F(NGraphReaderTests, ReadNetworkWithLongChain) {
+    const size_t numAdds = 1000;
+    const std::string modelPath = "ReadNetworkWithLongChain.xml";
+    const std::string weightsPath = "ReadNetworkWithLongChain.bin";
+    CommonTestUtils::createFile(modelPath, makeChainModel(numAdds));
+    CommonTestUtils::createFile(weightsPath, std::string(64, '\0'));
+
+    Core ie;
+    auto network = ie.ReadNetwork(modelPath, weightsPath);
+    CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+    ASSERT_EQ(2 * numAdds + 2, function->get_ops().size());
+    ASSERT_EQ(1, function->get_results().size());
+    std::shared_ptr<ngraph::Node> node = function->get_results()[0]->get_input_node_shared_ptr(0);
+    for (size_t i = numAdds; i > 0; i--) {
+        ASSERT_EQ("add_" + std::to_string(i - 1), node->get_friendly_name());
+        ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Add>(node));
+        ASSERT_EQ("const_" + std::to_string(i - 1), node->get_input_node_shared_ptr(1)->get_friendly_name());
+        node = node->get_input_node_shared_ptr(0);
+    }
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Parameter>(node));
+}
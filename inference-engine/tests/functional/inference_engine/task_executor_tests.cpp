@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -139,6 +140,27 @@ TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
 }
 
+TEST_P(TaskExecutorTests, canRunMoreTasksThanQueuesCanHold) {
+    auto taskExecutor = GetParam()();
+    static constexpr int THREAD_NUMBER = 4;
+    static constexpr int TASKS_PER_THREAD = 50000;
+    std::atomic_int counter = {0};
+    std::promise<void> done;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_NUMBER; i++) {
+        threads.emplace_back([&] {
+            for (int k = 0; k < TASKS_PER_THREAD; k++) {
+                taskExecutor->run([&] {
+                    if (++counter == THREAD_NUMBER * TASKS_PER_THREAD) done.set_value();
+                });
+            }
+        });
+    }
+    for (auto&& thread : threads) thread.join();
+    done.get_future().wait();
+    ASSERT_EQ(THREAD_NUMBER * TASKS_PER_THREAD, counter);
+}
+
 class ASyncTaskExecutorTests : public TaskExecutorTests {};
 
 // TODO: Issue-11695
@@ -212,3 +234,39 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+TEST(CPUStreamsExecutorTests, runsTasksInSubmissionOrderWhenQueueOverflows) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                1, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+    // the only stream is blocked, so tasks fill its queue and go to the overflow queue
+    static constexpr int TASKS_NUMBER = 5000;
+    std::promise<void> started, submitted, done;
+    auto submittedFuture = submitted.get_future().share();
+    std::vector<int> order;
+    auto task = [&](int i) {
+        return [&, i] {
+            order.push_back(i);
+            if (i == 0) {
+                // the queue has a free slot now, but the overflow queue is not drained yet
+                started.set_value();
+                submittedFuture.wait();
+            }
+            if (i == TASKS_NUMBER) done.set_value();
+        };
+    };
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    executor.run([gateFuture] { gateFuture.wait(); });
+    for (int i = 0; i < TASKS_NUMBER; i++) {
+        executor.run(task(i));
+    }
+    gate.set_value();
+    started.get_future().wait();
+    executor.run(task(TASKS_NUMBER));
+    submitted.set_value();
+    done.get_future().wait();
+    ASSERT_EQ(static_cast<size_t>(TASKS_NUMBER + 1), order.size());
+    for (int i = 0; i <= TASKS_NUMBER; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
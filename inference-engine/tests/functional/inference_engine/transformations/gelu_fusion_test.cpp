@@ -0,0 +1,175 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset2.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/gelu_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> create_gelu_reference() {
+    auto input = std::make_shared<ngraph::opset2::Parameter>(ngraph::element::f32, ngraph::Shape{2, 8, 16});
+    auto gelu = std::make_shared<ngraph::opset2::Gelu>(input);
+
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{gelu}, ngraph::ParameterVector{input});
+}
+
+}  // namespace
+
+TEST(TransformationTests, GeluFusionWithErfOne) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset2::Parameter>(ngraph::element::f32, ngraph::Shape{2, 8, 16});
+        auto sqrt2 = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {std::sqrt(2.f)});
+        auto div = std::make_shared<ngraph::opset2::Divide>(input, sqrt2);
+        auto erf = std::make_shared<ngraph::opset2::Erf>(div);
+        auto one = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.f});
+        auto add = std::make_shared<ngraph::opset2::Add>(erf, one);
+        auto half = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5f});
+        auto mul_half = std::make_shared<ngraph::opset2::Multiply>(half, input);
+        auto mul = std::make_shared<ngraph::opset2::Multiply>(mul_half, add);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::GeluFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    f_ref = create_gelu_reference();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, GeluFusionWithErfTwo) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset2::Parameter>(ngraph::element::f32, ngraph::Shape{2, 8, 16});
+        auto inv_sqrt2 = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {0.70710678f});
+        auto mul_sqrt2 = std::make_shared<ngraph::opset2::Multiply>(input, inv_sqrt2);
+        auto erf = std::make_shared<ngraph::opset2::Erf>(mul_sqrt2);
+        auto one = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.f});
+        auto add = std::make_shared<ngraph::opset2::Add>(one, erf);
+        auto mul_input = std::make_shared<ngraph::opset2::Multiply>(input, add);
+        auto half = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {0.5f});
+        auto mul = std::make_shared<ngraph::opset2::Multiply>(mul_input, half);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::GeluFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    f_ref = create_gelu_reference();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, GeluFusionWithErfThree) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset2::Parameter>(ngraph::element::f32, ngraph::Shape{2, 8, 16});
+        auto sqrt2 = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.4142135f});
+        auto div = std::make_shared<ngraph::opset2::Divide>(input, sqrt2);
+        auto erf = std::make_shared<ngraph::opset2::Erf>(div);
+        auto one = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.f});
+        auto add = std::make_shared<ngraph::opset2::Add>(erf, one);
+        auto half = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5f});
+        auto mul_half = std::make_shared<ngraph::opset2::Multiply>(add, half);
+        auto mul = std::make_shared<ngraph::opset2::Multiply>(input, mul_half);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::GeluFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    f_ref = create_gelu_reference();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, GeluFusionWrongScale) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto input = std::make_shared<ngraph::opset2::Parameter>(ngraph::element::f32, ngraph::Shape{2, 8, 16});
+        auto sqrt2 = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f});
+        auto div = std::make_shared<ngraph::opset2::Divide>(input, sqrt2);
+        auto erf = std::make_shared<ngraph::opset2::Erf>(div);
+        auto one = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.f});
+        auto add = std::make_shared<ngraph::opset2::Add>(erf, one);
+        auto half = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5f});
+        auto mul_half = std::make_shared<ngraph::opset2::Multiply>(input, half);
+        auto mul = std::make_shared<ngraph::opset2::Multiply>(mul_half, add);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{input});
+    };
+
+    f = create_function();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::GeluFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, GeluFusionBroadcastingConstant) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto input = std::make_shared<ngraph::opset2::Parameter>(ngraph::element::f32, ngraph::Shape{8, 16});
+        auto sqrt2 = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {std::sqrt(2.f)});
+        auto div = std::make_shared<ngraph::opset2::Divide>(input, sqrt2);
+        auto erf = std::make_shared<ngraph::opset2::Erf>(div);
+        auto one = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.f});
+        auto add = std::make_shared<ngraph::opset2::Add>(erf, one);
+        // the single element of a higher rank makes the result [1, 8, 16]
+        auto half = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1}, {0.5f});
+        auto mul_half = std::make_shared<ngraph::opset2::Multiply>(input, half);
+        auto mul = std::make_shared<ngraph::opset2::Multiply>(mul_half, add);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{input});
+    };
+
+    f = create_function();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::GeluFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+    ASSERT_EQ((ngraph::Shape{1, 8, 16}), f->get_output_shape(0));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,179 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph_ops/layer_norm.hpp>
+#include <transformations/common_optimizations/layer_norm_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, LayerNormFusionWithDivide) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 5, 8});
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {-1});
+        auto mean = std::make_shared<ngraph::opset1::ReduceMean>(input, axes, true);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(input, mean);
+        auto exponent = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f});
+        auto pow = std::make_shared<ngraph::opset1::Power>(sub, exponent);
+        auto variance = std::make_shared<ngraph::opset1::ReduceMean>(pow, axes, true);
+        auto eps = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1e-12f});
+        auto add_eps = std::make_shared<ngraph::opset1::Add>(variance, eps);
+        auto sqrt = std::make_shared<ngraph::opset1::Sqrt>(add_eps);
+        auto div = std::make_shared<ngraph::opset1::Divide>(sub, sqrt);
+        auto gamma = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 2.f));
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(div, gamma);
+        auto beta = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 8}, std::vector<float>(8, 0.5f));
+        auto add = std::make_shared<ngraph::opset1::Add>(mul, beta);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::LayerNormFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 5, 8});
+        auto gamma = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 2.f));
+        auto beta = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 0.5f));
+        auto layer_norm = std::make_shared<ngraph::op::LayerNorm>(input, gamma, beta, 1e-12f);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{layer_norm}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto layer_norm = std::dynamic_pointer_cast<ngraph::op::LayerNorm>(f->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, layer_norm);
+    ASSERT_FLOAT_EQ(1e-12f, layer_norm->get_eps());
+}
+
+TEST(TransformationTests, LayerNormFusionWithPower) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{6, 16});
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto mean = std::make_shared<ngraph::opset1::ReduceMean>(input, axes, true);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(input, mean);
+        auto sub_sq = std::make_shared<ngraph::opset1::Subtract>(input, mean);
+        auto square = std::make_shared<ngraph::opset1::Multiply>(sub_sq, sub_sq);
+        auto variance = std::make_shared<ngraph::opset1::ReduceMean>(square, axes, true);
+        auto eps = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1e-5f});
+        auto add_eps = std::make_shared<ngraph::opset1::Add>(eps, variance);
+        auto exponent = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {-0.5f});
+        auto rstd = std::make_shared<ngraph::opset1::Power>(add_eps, exponent);
+        auto norm = std::make_shared<ngraph::opset1::Multiply>(rstd, sub);
+        auto gamma = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16}, std::vector<float>(16, 1.5f));
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(gamma, norm);
+        auto beta = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.25f});
+        auto add = std::make_shared<ngraph::opset1::Add>(beta, mul);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::LayerNormFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{6, 16});
+        auto gamma = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16}, std::vector<float>(16, 1.5f));
+        auto beta = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16}, std::vector<float>(16, 0.25f));
+        auto layer_norm = std::make_shared<ngraph::op::LayerNorm>(input, gamma, beta, 1e-5f);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{layer_norm}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, LayerNormFusionNotOnLastAxis) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 5, 8});
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto mean = std::make_shared<ngraph::opset1::ReduceMean>(input, axes, true);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(input, mean);
+        auto exponent = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f});
+        auto pow = std::make_shared<ngraph::opset1::Power>(sub, exponent);
+        auto variance = std::make_shared<ngraph::opset1::ReduceMean>(pow, axes, true);
+        auto eps = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1e-5f});
+        auto add_eps = std::make_shared<ngraph::opset1::Add>(variance, eps);
+        auto sqrt = std::make_shared<ngraph::opset1::Sqrt>(add_eps);
+        auto div = std::make_shared<ngraph::opset1::Divide>(sub, sqrt);
+        auto gamma = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 2.f));
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(div, gamma);
+        auto beta = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 0.5f));
+        auto add = std::make_shared<ngraph::opset1::Add>(mul, beta);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+    };
+
+    f = create_function();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::LayerNormFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, LayerNormFusionSharedMean) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 5, 8});
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {2});
+        auto mean = std::make_shared<ngraph::opset1::ReduceMean>(input, axes, true);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(input, mean);
+        auto exponent = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f});
+        auto pow = std::make_shared<ngraph::opset1::Power>(sub, exponent);
+        auto variance = std::make_shared<ngraph::opset1::ReduceMean>(pow, axes, true);
+        auto eps = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1e-5f});
+        auto add_eps = std::make_shared<ngraph::opset1::Add>(variance, eps);
+        auto sqrt = std::make_shared<ngraph::opset1::Sqrt>(add_eps);
+        auto div = std::make_shared<ngraph::opset1::Divide>(sub, sqrt);
+        auto gamma = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 2.f));
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(div, gamma);
+        auto beta = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8}, std::vector<float>(8, 0.5f));
+        auto add = std::make_shared<ngraph::opset1::Add>(mul, beta);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(mean);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{add, relu}, ngraph::ParameterVector{input});
+    };
+
+    f = create_function();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::LayerNormFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
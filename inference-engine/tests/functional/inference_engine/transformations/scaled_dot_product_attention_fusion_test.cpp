@@ -0,0 +1,151 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph_ops/scaled_dot_product_attention.hpp>
+#include <transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 10, 8});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 12, 8});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 12, 6});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 1, 1, 12});
+        auto matmul_qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto divisor = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {4.f});
+        auto divide = std::make_shared<ngraph::opset1::Divide>(matmul_qk, divisor);
+        auto add = std::make_shared<ngraph::opset1::Add>(mask, divide);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, 3);
+        auto matmul_v = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul_v}, ngraph::ParameterVector{query, key, value, mask});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 10, 8});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 12, 8});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 12, 6});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 1, 1, 12});
+        auto attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(query, key, value, mask, 0.25f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value, mask});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto attention = std::dynamic_pointer_cast<ngraph::op::ScaledDotProductAttention>(
+        f->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, attention);
+    ASSERT_FLOAT_EQ(0.25f, attention->get_scale());
+    ASSERT_FALSE(attention->get_key_transposed());
+    ASSERT_EQ((ngraph::Shape{2, 4, 10, 6}), attention->get_output_shape(0));
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionTransposedKeys) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 5, 16});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 16, 7});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto matmul_qk = std::make_shared<ngraph::opset1::MatMul>(query, key);
+        auto factor = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {0.5f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(matmul_qk, factor);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(multiply, 2);
+        auto matmul_v = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul_v}, ngraph::ParameterVector{query, key, value});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 5, 16});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 16, 7});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(query, key, value, 0.5f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionSoftmaxNotOnKeys) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto matmul_qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(matmul_qk, 1);
+        auto matmul_v = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul_v}, ngraph::ParameterVector{query, key, value});
+    };
+
+    f = create_function();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionSharedScores) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3, 7, 16});
+        auto matmul_qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(matmul_qk, 2);
+        auto matmul_v = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(matmul_qk);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul_v, relu}, ngraph::ParameterVector{query, key, value});
+    };
+
+    f = create_function();
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset2.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Input shape [..., K]
+        size_t,                 // Output channels N
+        std::string             // Device name
+> FullyConnectedGeluTuple;
+
+class FullyConnectedGeluTest : public testing::WithParamInterface<FullyConnectedGeluTuple>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FullyConnectedGeluTuple> &obj) {
+        std::vector<size_t> inputShape;
+        size_t outputChannels;
+        std::string targetName;
+        std::tie(inputShape, outputChannels, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "N=" << outputChannels << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> inputShape;
+        size_t outputChannels;
+        std::tie(inputShape, outputChannels, targetDevice) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {inputShape.back(), outputChannels}, {}, true);
+        auto matMul = std::make_shared<ngraph::opset2::MatMul>(params[0], weights);
+        auto bias = ngraph::builder::makeConstant<float>(ngraph::element::f32, {outputChannels}, {}, true);
+        auto x = std::make_shared<ngraph::opset2::Add>(matMul, bias);
+
+        // the decomposed GELU as exported by BERT-like models: 0.5 * x * (1 + erf(x / sqrt(2)))
+        auto sqrt2 = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {std::sqrt(2.f)});
+        auto div = std::make_shared<ngraph::opset2::Divide>(x, sqrt2);
+        auto erf = std::make_shared<ngraph::opset2::Erf>(div);
+        auto one = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.f});
+        auto add = std::make_shared<ngraph::opset2::Add>(erf, one);
+        auto mulInput = std::make_shared<ngraph::opset2::Multiply>(x, add);
+        auto half = ngraph::opset2::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5f});
+        auto gelu = std::make_shared<ngraph::opset2::Multiply>(mulInput, half);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset2::Result>(gelu)};
+        function = std::make_shared<ngraph::Function>(results, params, "fully_connected_gelu");
+    }
+
+    void CheckFusedNodes() {
+        ASSERT_EQ(1u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "FullyConnected"));
+        ASSERT_EQ(0u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "Eltwise"));
+    }
+};
+
+TEST_P(FullyConnectedGeluTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedNodes();
+}
+
+namespace {
+
+std::vector<std::vector<size_t>> inputShapes = {
+        {4, 64},
+        {1, 16, 48},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FullyConnectedGelu, FullyConnectedGeluTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(32, 100),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        FullyConnectedGeluTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,149 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <exec_graph_info.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/variant.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        size_t,                             // Sequence length of the TensorIterator
+        std::map<std::string, std::string>, // Configuration
+        std::string                         // Device name
+> ImportExportNetworkTuple;
+
+class ImportExportNetworkTest : public testing::WithParamInterface<ImportExportNetworkTuple>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ImportExportNetworkTuple> &obj) {
+        size_t seqLength;
+        std::map<std::string, std::string> config;
+        std::string targetName;
+        std::tie(seqLength, config, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "seqLength=" << seqLength << "_";
+        for (auto&& item : config) {
+            results << item.first << "=" << item.second << "_";
+        }
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        size_t seqLength;
+        std::tie(seqLength, configuration, targetDevice) = this->GetParam();
+        const size_t channels = 16;
+
+        // convolution and fully connected weights are packed by the compiled graph
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 8, 8}, {1, seqLength, channels}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                     {1, 1}, ngraph::op::PadType::EXPLICIT, channels);
+        auto relu = std::make_shared<ngraph::opset4::Relu>(conv);
+        auto pool = std::make_shared<ngraph::opset4::ReduceMean>(relu,
+            ngraph::opset4::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {2, 3}), false);
+        auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {channels, channels}, {}, true);
+        auto fc = std::make_shared<ngraph::opset4::MatMul>(pool, weights);
+        std::vector<int64_t> initShape = {1, 1, static_cast<int64_t>(channels)};
+        auto init = std::make_shared<ngraph::opset4::Reshape>(fc,
+            ngraph::opset4::Constant::create(ngraph::element::i64, ngraph::Shape{3}, initShape), false);
+
+        // the TensorIterator body is a network of its own
+        auto xi = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        auto hi = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        auto sum = std::make_shared<ngraph::opset4::Add>(xi, hi);
+        auto bodyRelu = std::make_shared<ngraph::opset4::Relu>(sum);
+        auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{bodyRelu}, ngraph::ParameterVector{xi, hi});
+
+        auto ti = std::make_shared<ngraph::opset4::TensorIterator>();
+        ti->set_body(body);
+        ti->set_sliced_input(xi, params[1], 0, 1, 1, -1, 1);
+        ti->set_merged_input(hi, init, bodyRelu);
+        auto last = ti->get_iter_value(bodyRelu, -1);
+        auto all = ti->get_concatenated_slices(bodyRelu, 0, 1, 1, -1, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset4::Result>(last),
+                                     std::make_shared<ngraph::opset4::Result>(all)};
+        function = std::make_shared<ngraph::Function>(results, params, "import_export_network");
+    }
+
+    static std::vector<std::string> primitiveTypes(InferenceEngine::ExecutableNetwork &network) {
+        auto execFunction = network.GetExecGraphInfo().getFunction();
+        std::vector<std::string> types;
+        for (const auto &node : execFunction->get_ordered_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::IMPL_TYPE);
+            types.push_back(node->get_friendly_name() + ":" + (it == rtInfo.end() ? std::string{} :
+                std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second)->get()));
+        }
+        return types;
+    }
+
+    void ImportAndCompare() {
+        std::stringstream model;
+        executableNetwork.Export(model);
+        auto importedNetwork = core->ImportNetwork(model, targetDevice, configuration);
+
+        ASSERT_EQ(executableNetwork.GetInputsInfo().size(), importedNetwork.GetInputsInfo().size());
+        ASSERT_EQ(executableNetwork.GetOutputsInfo().size(), importedNetwork.GetOutputsInfo().size());
+        // the imported graph is compiled into the same primitives
+        ASSERT_EQ(primitiveTypes(executableNetwork), primitiveTypes(importedNetwork));
+
+        auto importedRequest = importedNetwork.CreateInferRequest();
+        size_t i = 0;
+        for (const auto &input : executableNetwork.GetInputsInfo()) {
+            importedRequest.SetBlob(input.first, inputs[i++]);
+        }
+        importedRequest.Infer();
+
+        // the same kernels run on the same packed weights
+        for (const auto &output : executableNetwork.GetOutputsInfo()) {
+            auto expected = inferRequest.GetBlob(output.first);
+            auto actual = importedRequest.GetBlob(output.first);
+            ASSERT_EQ(expected->byteSize(), actual->byteSize());
+            auto expectedMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(expected)->rmap();
+            auto actualMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(actual)->rmap();
+            ASSERT_EQ(0, std::memcmp(expectedMemory.as<const void*>(), actualMemory.as<const void*>(),
+                                     expected->byteSize())) << "output " << output.first;
+        }
+    }
+};
+
+TEST_P(ImportExportNetworkTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    ImportAndCompare();
+}
+
+namespace {
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportExportNetwork, ImportExportNetworkTest,
+                        ::testing::Combine(
+                                ::testing::Values(1, 5),
+                                ::testing::ValuesIn(configs),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ImportExportNetworkTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
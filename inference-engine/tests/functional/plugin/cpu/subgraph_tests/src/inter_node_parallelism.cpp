@@ -0,0 +1,116 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        size_t,                             // Number of independent branches
+        std::map<std::string, std::string>, // Configuration
+        std::string                         // Device name
+> InterNodeParallelismTuple;
+
+class InterNodeParallelismTest : public testing::WithParamInterface<InterNodeParallelismTuple>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterNodeParallelismTuple> &obj) {
+        size_t branches;
+        std::map<std::string, std::string> config;
+        std::string targetName;
+        std::tie(branches, config, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "branches=" << branches << "_";
+        for (auto&& item : config) {
+            results << item.first << "=" << item.second << "_";
+        }
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        size_t branches;
+        std::tie(branches, configuration, targetDevice) = this->GetParam();
+        configuration[InferenceEngine::PluginConfigParams::KEY_CPU_INTER_NODE_PARALLELISM] =
+            InferenceEngine::PluginConfigParams::YES;
+        const size_t channels = 8;
+
+        // independent branches of different depth make intermediate buffers of one branch reuse the memory
+        // released by another one, so the executor has to respect both data and memory reuse dependencies
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, channels, 16, 16}});
+        ngraph::OutputVector branchOutputs;
+        for (size_t i = 0; i < branches; i++) {
+            ngraph::Output<ngraph::Node> branch = params[0];
+            for (size_t depth = 0; depth <= i % 3; depth++) {
+                auto conv = ngraph::builder::makeConvolution(branch, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1},
+                                                             {1, 1}, {1, 1}, ngraph::op::PadType::EXPLICIT, channels);
+                branch = std::make_shared<ngraph::opset4::Relu>(conv);
+            }
+            auto pool = std::make_shared<ngraph::opset4::MaxPool>(branch, ngraph::Strides{1, 1}, ngraph::Shape{1, 1},
+                                                                  ngraph::Shape{1, 1}, ngraph::Shape{3, 3});
+            branchOutputs.push_back(std::make_shared<ngraph::opset4::Multiply>(pool, branch));
+        }
+        auto concat = std::make_shared<ngraph::opset4::Concat>(branchOutputs, 1);
+        auto sum = std::make_shared<ngraph::opset4::Add>(branchOutputs.front(), branchOutputs.back());
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset4::Result>(concat),
+                                     std::make_shared<ngraph::opset4::Result>(sum)};
+        function = std::make_shared<ngraph::Function>(results, params, "inter_node_parallelism");
+    }
+
+    void CompareWithSerialExecution() {
+        auto serialConfig = configuration;
+        serialConfig[InferenceEngine::PluginConfigParams::KEY_CPU_INTER_NODE_PARALLELISM] =
+            InferenceEngine::PluginConfigParams::NO;
+        auto serialNetwork = core->LoadNetwork(cnnNetwork, targetDevice, serialConfig);
+        auto serialRequest = serialNetwork.CreateInferRequest();
+        size_t i = 0;
+        for (const auto &input : executableNetwork.GetInputsInfo()) {
+            serialRequest.SetBlob(input.first, inputs[i++]);
+        }
+        serialRequest.Infer();
+
+        // the same primitives run on the same data, only the order of independent nodes differs
+        for (const auto &output : executableNetwork.GetOutputsInfo()) {
+            Compare(serialRequest.GetBlob(output.first), inferRequest.GetBlob(output.first));
+        }
+    }
+};
+
+TEST_P(InterNodeParallelismTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CompareWithSerialExecution();
+}
+
+namespace {
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_InterNodeParallelism, InterNodeParallelismTest,
+                        ::testing::Combine(
+                                ::testing::Values(2, 6),
+                                ::testing::ValuesIn(configs),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        InterNodeParallelismTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
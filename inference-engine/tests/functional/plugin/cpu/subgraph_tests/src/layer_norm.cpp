@@ -0,0 +1,105 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Input shape, normalized over the last axis
+        bool,                   // Normalize by Power(variance + eps, -0.5) instead of dividing by Sqrt
+        std::string             // Device name
+> LayerNormTuple;
+
+class LayerNormTest : public testing::WithParamInterface<LayerNormTuple>,
+                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LayerNormTuple> &obj) {
+        std::vector<size_t> inputShape;
+        bool usePower;
+        std::string targetName;
+        std::tie(inputShape, usePower, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "UsePower=" << usePower << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> inputShape;
+        bool usePower;
+        std::tie(inputShape, usePower, targetDevice) = this->GetParam();
+
+        const size_t channels = inputShape.back();
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {-1});
+        auto mean = std::make_shared<ngraph::opset1::ReduceMean>(params[0], axes, true);
+        auto centered = std::make_shared<ngraph::opset1::Subtract>(params[0], mean);
+        auto two = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f});
+        auto square = std::make_shared<ngraph::opset1::Power>(centered, two);
+        auto variance = std::make_shared<ngraph::opset1::ReduceMean>(square, axes, true);
+        auto eps = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1e-5f});
+        auto varianceEps = std::make_shared<ngraph::opset1::Add>(variance, eps);
+        std::shared_ptr<ngraph::Node> norm;
+        if (usePower) {
+            auto exponent = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {-0.5f});
+            auto rstd = std::make_shared<ngraph::opset1::Power>(varianceEps, exponent);
+            norm = std::make_shared<ngraph::opset1::Multiply>(centered, rstd);
+        } else {
+            auto stddev = std::make_shared<ngraph::opset1::Sqrt>(varianceEps);
+            norm = std::make_shared<ngraph::opset1::Divide>(centered, stddev);
+        }
+        auto gamma = ngraph::builder::makeConstant<float>(ngraph::element::f32, {channels}, {}, true);
+        auto scaled = std::make_shared<ngraph::opset1::Multiply>(norm, gamma);
+        auto beta = ngraph::builder::makeConstant<float>(ngraph::element::f32, {channels}, {}, true);
+        auto shifted = std::make_shared<ngraph::opset1::Add>(scaled, beta);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(shifted)};
+        function = std::make_shared<ngraph::Function>(results, params, "layer_norm");
+    }
+
+    void CheckFusedNodes() {
+        ASSERT_EQ(1u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "LayerNorm"));
+    }
+};
+
+TEST_P(LayerNormTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedNodes();
+}
+
+namespace {
+
+std::vector<std::vector<size_t>> inputShapes = {
+        {2, 7},
+        {1, 16, 64},
+        {2, 3, 5, 37},
+        {1, 128, 768},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_LayerNorm, LayerNormTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(true, false),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        LayerNormTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,181 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t channels = 3, height = 4, width = 5;
+
+CNNNetwork makeReluNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, height, width});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr makeInput(const SizeVector& dims, Layout layout) {
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, dims, layout));
+    blob->allocate();
+    auto data = blob->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = static_cast<uint8_t>(i * 37 % 256);
+    return blob;
+}
+
+Blob::Ptr makeNHWCInput() {
+    return makeInput({1, channels, height, width}, Layout::NHWC);
+}
+
+// input value at (c, h, w) of a dense or ROI blob
+float inputValue(const Blob::Ptr& input, size_t c, size_t h, size_t w) {
+    const auto& blocking = input->getTensorDesc().getBlockingDesc();
+    const auto& strides = blocking.getStrides();
+    const auto& order = blocking.getOrder();
+    const size_t idx[] = {0, c, h, w};
+    size_t offset = blocking.getOffsetPadding();
+    for (size_t i = 0; i < order.size(); i++)
+        offset += idx[order[i]] * strides[i];
+    return input->cbuffer().as<const uint8_t*>()[offset];
+}
+
+// (x - mean) * scale of the input compared with the NCHW output of Relu
+void checkOutput(const Blob::Ptr& input, const Blob::Ptr& output, const std::vector<float>& scales,
+                 const std::function<float(size_t, size_t, size_t)>& mean) {
+    ASSERT_EQ(Layout::NCHW, output->getTensorDesc().getLayout());
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t c = 0; c < channels; c++) {
+        for (size_t h = 0; h < height; h++) {
+            for (size_t w = 0; w < width; w++) {
+                const float value = (inputValue(input, c, h, w) - mean(c, h, w)) * scales[c];
+                ASSERT_FLOAT_EQ(std::max(value, 0.f), outputData[(c * height + h) * width + w]) << c << " " << h << " " << w;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(CPUMeanScalePreprocessingTest, smoke_MeanValuesAndScalesOfU8NHWCInput) {
+    const std::vector<float> means = {10.f, 100.f, 200.f}, scales = {0.5f, 1.f, 2.f};
+
+    auto network = makeReluNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    auto& preProcess = inputInfo->getPreProcess();
+    preProcess.init(channels);
+    for (size_t c = 0; c < channels; c++) {
+        preProcess[c]->meanValue = means[c];
+        preProcess[c]->stdScale = scales[c];
+    }
+    preProcess.setVariant(MEAN_VALUE);
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    Core ie;
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto input = makeNHWCInput();
+    request.SetBlob("input", input);
+    request.Infer();
+
+    checkOutput(input, request.GetBlob(outputName), scales,
+                [&](size_t c, size_t, size_t) { return means[c]; });
+}
+
+void setMeanImage(PreProcessInfo& preProcess) {
+    preProcess.init(channels);
+    for (size_t c = 0; c < channels; c++) {
+        auto meanData = make_shared_blob<float>(TensorDesc(Precision::FP32, {height, width}, Layout::HW));
+        meanData->allocate();
+        auto data = meanData->buffer().as<float*>();
+        for (size_t i = 0; i < height * width; i++)
+            data[i] = static_cast<float>(c * 50 + i * 3);
+        preProcess.setMeanImageForChannel(meanData, c);
+    }
+    preProcess.setVariant(MEAN_IMAGE);
+}
+
+float meanImage(size_t c, size_t h, size_t w) {
+    return static_cast<float>(c * 50 + (h * width + w) * 3);
+}
+
+TEST(CPUMeanScalePreprocessingTest, smoke_MeanImageOfU8NHWCInput) {
+    const std::vector<float> scales = {1.f, 1.f, 1.f};
+
+    auto network = makeReluNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    setMeanImage(inputInfo->getPreProcess());
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    Core ie;
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto input = makeNHWCInput();
+    request.SetBlob("input", input);
+    request.Infer();
+
+    checkOutput(input, request.GetBlob(outputName), scales, meanImage);
+}
+
+// ROI blobs are not dense, so they are converted to FP32 before mean subtraction as usual
+TEST(CPUMeanScalePreprocessingTest, smoke_MeanValuesAndScalesOfU8ROIInput) {
+    const std::vector<float> means = {10.f, 100.f, 200.f}, scales = {0.5f, 1.f, 2.f};
+
+    auto network = makeReluNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    auto& preProcess = inputInfo->getPreProcess();
+    preProcess.init(channels);
+    for (size_t c = 0; c < channels; c++) {
+        preProcess[c]->meanValue = means[c];
+        preProcess[c]->stdScale = scales[c];
+    }
+    preProcess.setVariant(MEAN_VALUE);
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    Core ie;
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto input = make_shared_blob(makeInput({1, channels, height + 3, width + 2}, Layout::NHWC), ROI(0, 2, 1, width, height));
+    request.SetBlob("input", input);
+    request.Infer();
+
+    checkOutput(input, request.GetBlob(outputName), scales,
+                [&](size_t c, size_t, size_t) { return means[c]; });
+}
+
+TEST(CPUMeanScalePreprocessingTest, smoke_MeanImageAndScalesOfU8NCHWROIInput) {
+    const std::vector<float> scales = {0.25f, 1.f, 3.f};
+
+    auto network = makeReluNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NCHW);
+    auto& preProcess = inputInfo->getPreProcess();
+    setMeanImage(preProcess);
+    for (size_t c = 0; c < channels; c++)
+        preProcess[c]->stdScale = scales[c];
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    Core ie;
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto input = make_shared_blob(makeInput({2, channels, height + 1, width + 4}, Layout::NCHW), ROI(1, 3, 1, width, height));
+    request.SetBlob("input", input);
+    request.Infer();
+
+    checkOutput(input, request.GetBlob(outputName), scales, meanImage);
+}
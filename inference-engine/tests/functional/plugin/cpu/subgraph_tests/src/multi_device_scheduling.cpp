@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t N = 256;
+
+// a chain of matrix multiplications
+CNNNetwork makeMatMulNetwork(size_t depth) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{N, N});
+    param->set_friendly_name("input");
+    std::shared_ptr<ngraph::Node> node = param;
+    for (size_t i = 0; i < depth; i++) {
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{N, N},
+                                                        std::vector<float>(N * N, 1.f / N));
+        node = std::make_shared<ngraph::opset1::MatMul>(node, weights);
+    }
+    auto relu = std::make_shared<ngraph::opset1::Relu>(node);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr makeInput(float value) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {N, N}, Layout::NC));
+    blob->allocate();
+    auto data = blob->buffer().as<float*>();
+    std::fill(data, data + blob->size(), value);
+    return blob;
+}
+
+ExecutableNetwork loadToMulti(Core& ie, const std::string& devices, size_t depth) {
+    return ie.LoadNetwork(makeMatMulNetwork(depth), CommonTestUtils::DEVICE_MULTI,
+                          {{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), devices},
+                           {PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}});
+}
+
+InferRequest createRequest(ExecutableNetwork& execNetwork, int priority, int deadline) {
+    execNetwork.SetConfig({{MULTI_CONFIG_KEY(REQUEST_PRIORITY), std::to_string(priority)},
+                           {MULTI_CONFIG_KEY(REQUEST_DEADLINE), std::to_string(deadline)}});
+    return execNetwork.CreateInferRequest();
+}
+
+}  // namespace
+
+TEST(MultiDeviceSchedulingTest, smoke_StartsWaitingRequestsByPriorityThenDeadline) {
+    Core ie;
+    auto execNetwork = loadToMulti(ie, std::string(CommonTestUtils::DEVICE_CPU) + "(1)", 1);
+
+    // the first request occupies the only worker, the rest are queued in the order of their start
+    std::vector<InferRequest> requests = {
+        createRequest(execNetwork, 0, 0),
+        createRequest(execNetwork, 0, 0),
+        createRequest(execNetwork, 0, 100000),
+        createRequest(execNetwork, 0, 10000),
+        createRequest(execNetwork, 1, 0),
+    };
+
+    // the worker is returned to the idle ones only after the callback of its request,
+    // so it is held by the first request until all the others are queued
+    std::promise<void> gate;
+    std::shared_future<void> gateOpened = gate.get_future().share();
+    std::mutex mutex;
+    std::vector<size_t> order;
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].SetInput({{"input", makeInput(1.f)}});
+        requests[i].SetCompletionCallback([&mutex, &order, gateOpened, i] {
+            if (0 == i)
+                gateOpened.wait();
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(i);
+        });
+    }
+    for (auto&& request : requests)
+        request.StartAsync();
+    gate.set_value();
+    for (auto&& request : requests)
+        ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ((std::vector<size_t>{0, 4, 3, 2, 1}), order);
+}
+
+TEST(MultiDeviceSchedulingTest, smoke_InfersRequestsWithHintsOnTwoDevices) {
+    Core ie;
+    const std::string secondDevice = std::string(CommonTestUtils::DEVICE_CPU) + "_2";
+    ie.RegisterPlugin(std::string("MKLDNNPlugin") + IE_BUILD_POSTFIX, secondDevice);
+    auto execNetwork = loadToMulti(ie, std::string(CommonTestUtils::DEVICE_CPU) + "," + secondDevice, 2);
+    const auto outputName = execNetwork.GetOutputsInfo().begin()->first;
+
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 16; i++)
+        requests.push_back(createRequest(execNetwork, i % 3, (i % 2) * 50));
+    EXPECT_EQ("2", execNetwork.GetConfig(MULTI_CONFIG_KEY(REQUEST_PRIORITY)).as<std::string>());
+    EXPECT_EQ("50", execNetwork.GetConfig(MULTI_CONFIG_KEY(REQUEST_DEADLINE)).as<std::string>());
+
+    // several rounds, so that later requests with deadlines are placed according to the observed latencies
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].SetBlob("input", makeInput(static_cast<float>(i) - 4.f));
+            requests[i].StartAsync();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+            auto output = requests[i].GetBlob(outputName);
+            auto data = output->cbuffer().as<const float*>();
+            const float expected = std::max(static_cast<float>(i) - 4.f, 0.f);
+            for (size_t j = 0; j < output->size(); j++)
+                ASSERT_NEAR(expected, data[j], 1e-4f) << "request " << i << " element " << j;
+        }
+    }
+}
+
+TEST(MultiDeviceSchedulingTest, smoke_RejectsWrongHints) {
+    Core ie;
+    auto execNetwork = loadToMulti(ie, CommonTestUtils::DEVICE_CPU, 1);
+    ASSERT_THROW(execNetwork.SetConfig({{MULTI_CONFIG_KEY(REQUEST_PRIORITY), "high"}}), details::InferenceEngineException);
+    ASSERT_THROW(execNetwork.SetConfig({{MULTI_CONFIG_KEY(REQUEST_DEADLINE), "-1"}}), details::InferenceEngineException);
+    ASSERT_THROW(execNetwork.SetConfig({{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}}),
+                 details::InferenceEngineException);
+}
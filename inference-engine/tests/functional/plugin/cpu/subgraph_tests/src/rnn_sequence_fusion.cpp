@@ -0,0 +1,105 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::string,                                // Sequence type: LSTMSequence, GRUSequence or RNNSequence
+        ngraph::op::RecurrentSequenceDirection,     // Direction
+        size_t,                                     // Sequence length
+        std::string                                 // Device name
+> RNNSequenceFusionTuple;
+
+class RNNSequenceFusionTest : public testing::WithParamInterface<RNNSequenceFusionTuple>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RNNSequenceFusionTuple> &obj) {
+        std::string sequenceType;
+        ngraph::op::RecurrentSequenceDirection direction;
+        size_t seqLength;
+        std::string targetName;
+        std::tie(sequenceType, direction, seqLength, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "type=" << sequenceType << "_";
+        results << "direction=" << direction << "_";
+        results << "seqLength=" << seqLength << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::string sequenceType;
+        ngraph::op::RecurrentSequenceDirection direction;
+        size_t seqLength;
+        std::tie(sequenceType, direction, seqLength, targetDevice) = this->GetParam();
+        const size_t batch = 2, inputSize = 8, hiddenSize = 16;
+
+        // constant weights and full-length sequences are executed by a single RNN primitive
+        std::shared_ptr<ngraph::Node> sequence;
+        if (sequenceType == "LSTMSequence") {
+            auto params = ngraph::builder::makeParams(ngraph::element::f32,
+                {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}, {batch, 1, hiddenSize}});
+            sequence = ngraph::builder::makeLSTM(ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes(params)),
+                {{1, 4 * hiddenSize, inputSize}, {1, 4 * hiddenSize, hiddenSize}, {1, 4 * hiddenSize}, {batch}},
+                hiddenSize, {"sigmoid", "tanh", "tanh"}, {}, {}, 0.f, true, direction);
+            function = std::make_shared<ngraph::Function>(sequence->outputs(), params, "lstm_sequence_fusion");
+        } else if (sequenceType == "GRUSequence") {
+            auto params = ngraph::builder::makeParams(ngraph::element::f32,
+                {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}});
+            sequence = ngraph::builder::makeGRU(ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes(params)),
+                {{1, 3 * hiddenSize, inputSize}, {1, 3 * hiddenSize, hiddenSize}, {1, 3 * hiddenSize}, {batch}},
+                hiddenSize, {"sigmoid", "tanh"}, {}, {}, 0.f, false, true, direction);
+            function = std::make_shared<ngraph::Function>(sequence->outputs(), params, "gru_sequence_fusion");
+        } else {
+            auto params = ngraph::builder::makeParams(ngraph::element::f32,
+                {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}});
+            sequence = ngraph::builder::makeRNN(ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes(params)),
+                {{1, hiddenSize, inputSize}, {1, hiddenSize, hiddenSize}, {1, hiddenSize}, {batch}},
+                hiddenSize, {"tanh"}, {}, {}, 0.f, true, direction);
+            function = std::make_shared<ngraph::Function>(sequence->outputs(), params, "rnn_sequence_fusion");
+        }
+    }
+
+    void CheckFusedNodes() {
+        ASSERT_EQ(1u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "RNNSeq"));
+        ASSERT_EQ(0u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "TensorIterator"));
+    }
+};
+
+TEST_P(RNNSequenceFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedNodes();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_RNNSequenceFusion, RNNSequenceFusionTest,
+                        ::testing::Combine(
+                                ::testing::Values("LSTMSequence", "GRUSequence", "RNNSequence"),
+                                ::testing::Values(ngraph::op::RecurrentSequenceDirection::FORWARD,
+                                                  ngraph::op::RecurrentSequenceDirection::REVERSE),
+                                ::testing::Values(1, 5),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        RNNSequenceFusionTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_compound_blob.h>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t C = 3, H = 6, W = 7;
+
+CNNNetwork makeReluNetwork(size_t batch) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, C, H, W});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    inputInfo->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+    return network;
+}
+
+}  // namespace
+
+TEST(CPUROIBatchPreprocessingTest, smoke_ResizesEveryRegionToItsBatchItem) {
+    auto image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, C, 30, 40}, Layout::NHWC));
+    image->allocate();
+    auto data = image->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < image->size(); i++)
+        data[i] = static_cast<uint8_t>(i * 37 % 256);
+    const std::vector<ROI> rois = {{0, 0, 0, 40, 30}, {0, 5, 3, 12, 20}, {0, 30, 25, 4, 5}};
+
+    Core ie;
+    auto batchNetwork = makeReluNetwork(rois.size());
+    const auto outputName = batchNetwork.getOutputsInfo().begin()->first;
+    auto batchRequest = ie.LoadNetwork(batchNetwork, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    batchRequest.SetBlob("input", make_shared_blob<ROIBatchedBlob>(image, rois));
+    batchRequest.Infer();
+    auto batchOutput = batchRequest.GetBlob(outputName);
+    ASSERT_EQ(SizeVector({rois.size(), C, H, W}), batchOutput->getTensorDesc().getDims());
+
+    // every region must be processed exactly as if it was set alone
+    auto request = ie.LoadNetwork(makeReluNetwork(1), CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    for (size_t i = 0; i < rois.size(); i++) {
+        request.SetBlob("input", image->createROI(rois[i]));
+        request.Infer();
+        auto expected = request.GetBlob(outputName)->cbuffer().as<const float*>();
+        auto actual = batchOutput->cbuffer().as<const float*>() + i * C * H * W;
+        for (size_t j = 0; j < C * H * W; j++)
+            ASSERT_EQ(expected[j], actual[j]) << "region " << i << " element " << j;
+    }
+}
@@ -0,0 +1,231 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <exec_graph_info.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <ie_system_conf.h>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Query shape [..., L, D]
+        size_t,                 // Key length S
+        size_t,                 // Value size Dv
+        std::vector<size_t>,    // Mask shape, empty if there is no mask
+        bool,                   // Keys are multiplied with transpose_b
+        std::string             // Device name
+> ScaledDotProductAttentionTuple;
+
+class ScaledDotProductAttentionTest : public testing::WithParamInterface<ScaledDotProductAttentionTuple>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ScaledDotProductAttentionTuple> &obj) {
+        std::vector<size_t> queryShape, maskShape;
+        size_t keyLength, valueSize;
+        bool transposeB;
+        std::string targetName;
+        std::tie(queryShape, keyLength, valueSize, maskShape, transposeB, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "QS=" << CommonTestUtils::vec2str(queryShape) << "_";
+        results << "S=" << keyLength << "_";
+        results << "Dv=" << valueSize << "_";
+        results << "MS=" << CommonTestUtils::vec2str(maskShape) << "_";
+        results << "TransposeB=" << transposeB << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> queryShape, maskShape;
+        size_t keyLength, valueSize;
+        bool transposeB;
+        std::tie(queryShape, keyLength, valueSize, maskShape, transposeB, targetDevice) = this->GetParam();
+
+        const size_t rank = queryShape.size();
+        const size_t headSize = queryShape[rank - 1];
+        auto keyShape = queryShape;
+        keyShape[rank - 2] = transposeB ? keyLength : headSize;
+        keyShape[rank - 1] = transposeB ? headSize : keyLength;
+        auto valueShape = queryShape;
+        valueShape[rank - 2] = keyLength;
+        valueShape[rank - 1] = valueSize;
+
+        std::vector<std::vector<size_t>> shapes = {queryShape, keyShape, valueShape};
+        if (!maskShape.empty())
+            shapes.push_back(maskShape);
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, shapes);
+
+        auto matmulQK = std::make_shared<ngraph::opset1::MatMul>(params[0], params[1], false, transposeB);
+        auto divisor = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {std::sqrt(static_cast<float>(headSize))});
+        std::shared_ptr<ngraph::Node> scores = std::make_shared<ngraph::opset1::Divide>(matmulQK, divisor);
+        if (!maskShape.empty())
+            scores = std::make_shared<ngraph::opset1::Add>(scores, params[3]);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, rank - 1);
+        auto matmulV = std::make_shared<ngraph::opset1::MatMul>(softmax, params[2]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matmulV)};
+        function = std::make_shared<ngraph::Function>(results, params, "scaled_dot_product_attention");
+    }
+
+    void CheckFusedNodes() {
+        ASSERT_EQ(1u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "ScaledDotProductAttention"));
+        ASSERT_EQ(0u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "SoftMax"));
+    }
+};
+
+TEST_P(ScaledDotProductAttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedNodes();
+}
+
+typedef std::tuple<
+        std::vector<size_t>,    // Query shape [..., L, D]
+        size_t,                 // Key length S
+        size_t,                 // Value size Dv
+        std::string             // Device name
+> ScaledDotProductAttentionBF16Tuple;
+
+class ScaledDotProductAttentionBF16Test : public testing::WithParamInterface<ScaledDotProductAttentionBF16Tuple>,
+                                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ScaledDotProductAttentionBF16Tuple> &obj) {
+        std::vector<size_t> queryShape;
+        size_t keyLength, valueSize;
+        std::string targetName;
+        std::tie(queryShape, keyLength, valueSize, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "QS=" << CommonTestUtils::vec2str(queryShape) << "_";
+        results << "S=" << keyLength << "_";
+        results << "Dv=" << valueSize << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> queryShape;
+        size_t keyLength, valueSize;
+        std::tie(queryShape, keyLength, valueSize, targetDevice) = this->GetParam();
+        configuration[InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16] = InferenceEngine::PluginConfigParams::YES;
+        // bf16 keeps 8 significant bits of the projections, the scores and the result
+        threshold = 0.05f;
+
+        const size_t rank = queryShape.size();
+        const size_t headSize = queryShape[rank - 1];
+        auto keyShape = queryShape;
+        keyShape[rank - 2] = keyLength;
+        auto valueShape = queryShape;
+        valueShape[rank - 2] = keyLength;
+        valueShape[rank - 1] = valueSize;
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {queryShape, keyShape, valueShape});
+
+        // projections are executed in bf16, so the attention gets bf16 queries, keys and values
+        auto project = [](const ngraph::Output<ngraph::Node> &input, size_t size) {
+            std::vector<float> weights(size * size);
+            for (size_t i = 0; i < weights.size(); i++)
+                weights[i] = static_cast<float>(static_cast<int>(i * 7 % 5) - 2) / 16.f;
+            return std::make_shared<ngraph::opset1::MatMul>(input,
+                ngraph::builder::makeConstant(ngraph::element::f32, {size, size}, weights));
+        };
+        auto query = project(params[0], headSize);
+        auto key = project(params[1], headSize);
+        auto value = project(params[2], valueSize);
+
+        auto matmulQK = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto divisor = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {std::sqrt(static_cast<float>(headSize))});
+        auto scores = std::make_shared<ngraph::opset1::Divide>(matmulQK, divisor);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, rank - 1);
+        auto matmulV = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matmulV)};
+        function = std::make_shared<ngraph::Function>(results, params, "scaled_dot_product_attention_bf16");
+    }
+
+    // values in [-1, 1) with a step of 1/32 are exact in bf16
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 32);
+    }
+
+    void CheckBF16Execution() {
+        auto attentionNodes = CPUTestUtils::getExecNodesOfType(executableNetwork, "ScaledDotProductAttention");
+        ASSERT_EQ(1u, attentionNodes.size());
+        const auto &rtInfo = attentionNodes.front()->get_rt_info();
+        auto precision = rtInfo.find(ExecGraphInfoSerialization::OUTPUT_PRECISIONS);
+        ASSERT_NE(rtInfo.end(), precision);
+        ASSERT_EQ("BF16", std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(precision->second)->get());
+    }
+};
+
+TEST_P(ScaledDotProductAttentionBF16Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // there are no bf16 primitives to feed the node without AVX512-BF16
+    if (!InferenceEngine::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+
+    Run();
+    CheckBF16Execution();
+}
+
+namespace {
+
+std::vector<std::vector<size_t>> queryShapes = {
+        {1, 12, 8},
+        {2, 4, 37, 16},
+        {1, 2, 128, 64},
+};
+
+std::vector<size_t> keyLengths = {1, 13, 64, 150};
+
+INSTANTIATE_TEST_CASE_P(smoke_ScaledDotProductAttention, ScaledDotProductAttentionTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(queryShapes),
+                                ::testing::ValuesIn(keyLengths),
+                                ::testing::Values(8, 20),
+                                ::testing::Values(std::vector<size_t>{}),
+                                ::testing::Values(true, false),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ScaledDotProductAttentionTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_ScaledDotProductAttentionWithMask, ScaledDotProductAttentionTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{2, 4, 37, 16}),
+                                ::testing::Values(70),
+                                ::testing::Values(16),
+                                ::testing::Values(std::vector<size_t>{2, 1, 1, 70},
+                                                  std::vector<size_t>{37, 70},
+                                                  std::vector<size_t>{2, 4, 37, 70}),
+                                ::testing::Values(true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ScaledDotProductAttentionTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_ScaledDotProductAttention_BF16, ScaledDotProductAttentionBF16Test,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{2, 4, 37, 16},
+                                                  std::vector<size_t>{1, 2, 128, 64}),
+                                ::testing::Values(13, 150),
+                                ::testing::Values(16),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ScaledDotProductAttentionBF16Test::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
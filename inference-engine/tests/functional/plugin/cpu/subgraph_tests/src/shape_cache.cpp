@@ -0,0 +1,176 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+CNNNetwork makeReluNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2, 4, 4});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr makeInput(const SizeVector& dims) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, Layout::NCHW));
+    blob->allocate();
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = (i % 2) ? static_cast<float>(i) : -static_cast<float>(i);
+    return blob;
+}
+
+}  // namespace
+
+TEST(CPUShapeCacheTest, smoke_InfersInputsOfOtherShapes) {
+    Core ie;
+    auto network = makeReluNetwork();
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "2"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    for (const SizeVector& dims : {SizeVector{1, 2, 3, 5}, SizeVector{1, 2, 4, 4}, SizeVector{1, 2, 7, 2},
+                                   SizeVector{1, 2, 6, 6}, SizeVector{1, 2, 3, 5}}) {
+        auto input = makeInput(dims);
+        request.SetBlob("input", input);
+        request.Infer();
+
+        auto output = request.GetBlob(outputName);
+        ASSERT_EQ(dims, output->getTensorDesc().getDims());
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            ASSERT_EQ(std::max(inputData[i], 0.f), outputData[i]) << "element " << i;
+    }
+}
+
+TEST(CPUShapeCacheTest, smoke_PadsInputsToShapeBucket) {
+    Core ie;
+    auto network = makeReluNetwork();
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "1"},
+                                       {PluginConfigParams::KEY_CPU_SHAPE_BUCKET, "8"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    auto input = makeInput({1, 2, 3, 4});
+    request.SetBlob("input", input);
+    request.Infer();
+
+    auto output = request.GetBlob(outputName);
+    ASSERT_EQ((SizeVector{1, 2, 8, 4}), output->getTensorDesc().getDims());
+    auto inputData = input->cbuffer().as<const float*>();
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t c = 0; c < 2; c++) {
+        for (size_t h = 0; h < 8; h++) {
+            for (size_t w = 0; w < 4; w++) {
+                const float expected = h < 3 ? std::max(inputData[(c * 3 + h) * 4 + w], 0.f) : 0.f;
+                ASSERT_EQ(expected, outputData[(c * 8 + h) * 4 + w]) << c << " " << h << " " << w;
+            }
+        }
+    }
+}
+
+TEST(CPUShapeCacheTest, smoke_ClearsPaddingOfSmallerInputs) {
+    Core ie;
+    auto network = makeReluNetwork();
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "1"},
+                                       {PluginConfigParams::KEY_CPU_SHAPE_BUCKET, "8"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    // both inputs are padded to the same shape, the second one must not see the rows of the first one
+    request.SetBlob("input", makeInput({1, 2, 7, 4}));
+    request.Infer();
+    request.SetBlob("input", makeInput({1, 2, 3, 4}));
+    request.Infer();
+
+    auto output = request.GetBlob(outputName);
+    ASSERT_EQ((SizeVector{1, 2, 8, 4}), output->getTensorDesc().getDims());
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t c = 0; c < 2; c++) {
+        for (size_t h = 3; h < 8; h++) {
+            for (size_t w = 0; w < 4; w++)
+                ASSERT_EQ(0.f, outputData[(c * 8 + h) * 4 + w]) << c << " " << h << " " << w;
+        }
+    }
+}
+
+TEST(CPUShapeCacheTest, smoke_PadsInputsToNetworkShape) {
+    Core ie;
+    auto network = makeReluNetwork();
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "1"},
+                                       {PluginConfigParams::KEY_CPU_SHAPE_BUCKET, "2"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    // the height of 3 is rounded up to the network one, so the input is padded for the network graph
+    request.SetBlob("input", makeInput({1, 2, 4, 4}));
+    request.Infer();
+    auto input = makeInput({1, 2, 3, 4});
+    request.SetBlob("input", input);
+    request.Infer();
+
+    auto output = request.GetBlob(outputName);
+    ASSERT_EQ((SizeVector{1, 2, 4, 4}), output->getTensorDesc().getDims());
+    auto inputData = input->cbuffer().as<const float*>();
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t c = 0; c < 2; c++) {
+        for (size_t h = 0; h < 4; h++) {
+            for (size_t w = 0; w < 4; w++) {
+                const float expected = h < 3 ? std::max(inputData[(c * 3 + h) * 4 + w], 0.f) : 0.f;
+                ASSERT_EQ(expected, outputData[(c * 4 + h) * 4 + w]) << c << " " << h << " " << w;
+            }
+        }
+    }
+}
+
+TEST(CPUShapeCacheTest, smoke_KeepsOutputBlobsSetByUser) {
+    Core ie;
+    auto network = makeReluNetwork();
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                      {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, "2"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    auto input = makeInput({1, 2, 3, 5});
+    auto output = makeInput({1, 2, 3, 5});
+    request.SetBlob("input", input);
+    request.SetBlob(outputName, output);
+    request.Infer();
+
+    ASSERT_EQ(output, request.GetBlob(outputName));
+    auto inputData = input->cbuffer().as<const float*>();
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        ASSERT_EQ(std::max(inputData[i], 0.f), outputData[i]) << "element " << i;
+
+    // the graph for other input shapes can't write into the blob
+    request.SetBlob("input", makeInput({1, 2, 6, 6}));
+    ASSERT_THROW(request.Infer(), details::InferenceEngineException);
+}
+
+TEST(CPUShapeCacheTest, smoke_RejectsOtherShapesWhenDisabled) {
+    Core ie;
+    auto execNetwork = ie.LoadNetwork(makeReluNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNetwork.CreateInferRequest();
+    ASSERT_THROW(request.SetBlob("input", makeInput({1, 2, 3, 5})), details::InferenceEngineException);
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Convolution branch fed by the input added to a branch computed from constants only
+std::shared_ptr<ngraph::Function> makeConstantBranchFunction() {
+    const auto prc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(prc, {{1, 4, 16, 16}});
+    auto conv = ngraph::builder::makeConvolution(params[0], prc, {3, 3}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+
+    auto constant = ngraph::builder::makeConstant<float>(prc, {1, 8, 14, 14}, {}, true, 10, 0);
+    auto scale = ngraph::builder::makeConstant<float>(prc, {1, 8, 1, 1}, {}, true, 3, 1);
+    auto constantBranch = std::make_shared<ngraph::opset1::Multiply>(
+            std::make_shared<ngraph::opset1::Relu>(constant), scale);
+
+    auto add = std::make_shared<ngraph::opset1::Add>(relu, constantBranch);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(add)},
+                                              params);
+}
+
+}  // namespace
+
+// With exclusive async requests both networks run on one stream thread, so their graphs share the
+// intermediate workspace. Each inference must not see the data the other network left in it.
+TEST(CPUSharedWorkspaceTest, smoke_NetworksRunAlternatelyOnOneThread) {
+    Core ie;
+    std::vector<std::shared_ptr<ngraph::Function>> functions = {
+        ngraph::builder::subgraph::makeSplitConvConcat({1, 4, 32, 32}),
+        makeConstantBranchFunction(),
+    };
+    std::vector<InferRequest> requests;
+    std::vector<std::string> inputNames, outputNames;
+    for (const auto& function : functions) {
+        CNNNetwork network(function);
+        auto execNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                          {{PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES}});
+        requests.push_back(execNetwork.CreateInferRequest());
+        inputNames.push_back(network.getInputsInfo().begin()->first);
+        outputNames.push_back(network.getOutputsInfo().begin()->first);
+    }
+
+    const auto threshold = FuncTestUtils::GetComparisonThreshold(Precision::FP32);
+    for (int iteration = 0; iteration < 3; iteration++) {
+        for (size_t i = 0; i < functions.size(); i++) {
+            auto input = FuncTestUtils::createAndFillBlobFloat(requests[i].GetBlob(inputNames[i])->getTensorDesc(),
+                                                               10, -5, 100, iteration * 2 + i + 1);
+            requests[i].SetBlob(inputNames[i], input);
+            requests[i].Infer();
+
+            auto inputData = input->cbuffer().as<const uint8_t*>();
+            auto reference = ngraph::helpers::interpreterFunction(
+                    functions[i], {std::vector<uint8_t>(inputData, inputData + input->byteSize())}).front();
+            auto output = requests[i].GetBlob(outputNames[i]);
+            const auto outputSize = reference.size() / sizeof(float);
+            ASSERT_EQ(outputSize, output->size());
+            FuncTestUtils::compareRawBuffers(output->cbuffer().as<const float*>(),
+                                             reinterpret_cast<const float*>(reference.data()),
+                                             outputSize, outputSize, threshold);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        bool,           // Body reads the slice by a fully connected layer behind a reshape instead of an eltwise one
+        int64_t,        // Stride of the sliced input and the concatenated output
+        size_t,         // Sequence length
+        std::string     // Device name
+> TensorIteratorSlicesTuple;
+
+class TensorIteratorSlicesTest : public testing::WithParamInterface<TensorIteratorSlicesTuple>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorSlicesTuple> &obj) {
+        bool fullyConnected;
+        int64_t stride;
+        size_t seqLength;
+        std::string targetName;
+        std::tie(fullyConnected, stride, seqLength, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "body=" << (fullyConnected ? "FullyConnected" : "Eltwise") << "_";
+        results << "stride=" << stride << "_";
+        results << "seqLength=" << seqLength << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        bool fullyConnected;
+        int64_t stride;
+        size_t seqLength;
+        std::tie(fullyConnected, stride, seqLength, targetDevice) = this->GetParam();
+        const size_t channels = 16;
+
+        // the body is not a recurrent cell, so the TensorIterator is executed as is and reads its slices in place
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, seqLength, channels}, {1, 1, channels}});
+        auto xi = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        auto hi = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        std::shared_ptr<ngraph::Node> x = xi;
+        if (fullyConnected) {
+            const auto channelsDim = static_cast<int64_t>(channels);
+            auto flat = std::make_shared<ngraph::opset4::Reshape>(xi,
+                ngraph::opset4::Constant::create(ngraph::element::i64, ngraph::Shape{2},
+                                                 std::vector<int64_t>{1, channelsDim}), false);
+            auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {channels, channels}, {}, true);
+            auto fc = std::make_shared<ngraph::opset4::MatMul>(flat, weights);
+            x = std::make_shared<ngraph::opset4::Reshape>(fc,
+                ngraph::opset4::Constant::create(ngraph::element::i64, ngraph::Shape{3},
+                                                 std::vector<int64_t>{1, 1, channelsDim}), false);
+        }
+        auto sum = std::make_shared<ngraph::opset4::Add>(x, hi);
+        auto bodyRelu = std::make_shared<ngraph::opset4::Relu>(sum);
+        auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{bodyRelu}, ngraph::ParameterVector{xi, hi});
+
+        auto ti = std::make_shared<ngraph::opset4::TensorIterator>();
+        ti->set_body(body);
+        const int64_t start = stride > 0 ? 0 : -1, end = stride > 0 ? -1 : 0;
+        ti->set_sliced_input(xi, params[0], start, stride, 1, end, 1);
+        ti->set_merged_input(hi, params[1], bodyRelu);
+        auto last = ti->get_iter_value(bodyRelu, -1);
+        auto all = ti->get_concatenated_slices(bodyRelu, start, stride, 1, end, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset4::Result>(last),
+                                     std::make_shared<ngraph::opset4::Result>(all)};
+        function = std::make_shared<ngraph::Function>(results, params, "tensor_iterator_slices");
+    }
+
+    void CheckNoCopies() {
+        // slices are taken and gathered by the TensorIterator itself, not by separate split, concat or copy nodes
+        ASSERT_EQ(1u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, "TensorIterator"));
+        for (const auto &type : {"Concatenation", "Split", "Copy"}) {
+            ASSERT_EQ(0u, CPUTestUtils::getNumberOfExecNodes(executableNetwork, type)) << type;
+        }
+    }
+};
+
+TEST_P(TensorIteratorSlicesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNoCopies();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorSlices, TensorIteratorSlicesTest,
+                        ::testing::Combine(
+                                ::testing::Values(false, true),
+                                ::testing::Values(1, -1),
+                                ::testing::Values(1, 7),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        TensorIteratorSlicesTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
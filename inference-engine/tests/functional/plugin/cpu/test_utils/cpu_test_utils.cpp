@@ -187,4 +187,25 @@ std::vector<CPUSpecificParams> filterCPUSpecificParams(std::vector<CPUSpecificPa
     return paramsVector;
 }
 
+std::vector<std::shared_ptr<ngraph::Node>> getExecNodesOfType(InferenceEngine::ExecutableNetwork &execNet,
+                                                              const std::string &nodeType) {
+    auto function = execNet.GetExecGraphInfo().getFunction();
+    IE_ASSERT(nullptr != function);
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    for (const auto &node : function->get_ops()) {
+        const auto &rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        IE_ASSERT(rtInfo.end() != it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != value);
+        if (value->get() == nodeType)
+            nodes.push_back(node);
+    }
+    return nodes;
+}
+
+size_t getNumberOfExecNodes(InferenceEngine::ExecutableNetwork &execNet, const std::string &nodeType) {
+    return getExecNodesOfType(execNet, nodeType).size();
+}
+
 } // namespace CPUTestUtils
@@ -88,5 +88,8 @@ const auto conv_avx512_2D_1x1 = CPUSpecificParams{{nChw16c}, {nChw16c}, {"jit_av
 
 // utility functions
 std::vector<CPUSpecificParams> filterCPUSpecificParams(std::vector<CPUSpecificParams>& paramsVector);
+std::vector<std::shared_ptr<ngraph::Node>> getExecNodesOfType(InferenceEngine::ExecutableNetwork &execNet,
+                                                              const std::string &nodeType);
+size_t getNumberOfExecNodes(InferenceEngine::ExecutableNetwork &execNet, const std::string &nodeType);
 
 } // namespace CPUTestUtils
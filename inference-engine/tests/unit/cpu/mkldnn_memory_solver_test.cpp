@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
+#include <random>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -114,7 +117,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{    //  |            __________
             {6, 7, 3},         //  |   ____    |_3________|
             {2, 5, 2},         //  |  |_4__|_____ |    |
@@ -123,7 +126,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -233,9 +236,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -273,3 +274,70 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, RandomBoxesNoOverlapping) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> start_dist(0, 50), length_dist(0, 10), size_dist(0, 100);
+
+    for (int iter = 0; iter < 20; iter++) {
+        std::vector<Box> boxes;
+        for (int n = 0; n < 100; n++) {
+            int start = start_dist(gen);
+            boxes.push_back({start, start + length_dist(gen), size_dist(gen), n});
+        }
+
+        MKLDNNPlugin::MemorySolver ms(boxes);
+        const auto required = ms.solve();
+        EXPECT_GE(required, ms.maxDepth());
+
+        for (const auto& box1 : boxes) {
+            ASSERT_LE(ms.getOffset(box1.id) + box1.size, required);
+            for (const auto& box2 : boxes) {
+                if (box1.id == box2.id || box1.size == 0 || box2.size == 0)
+                    continue;
+                int64_t off1 = ms.getOffset(box1.id);
+                int64_t off2 = ms.getOffset(box2.id);
+                bool no_overlap = box1.finish < box2.start || box1.start > box2.finish ||
+                                  off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+                ASSERT_TRUE(no_overlap) << "Box overlapping is detected";
+            }
+        }
+    }
+}
+
+TEST(MemSolverTest, LargeBoxSetIsSolvedFast) {
+    // boxes of a long chain-like graph with a few long living ones, like a deep unrolled network
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> length_dist(1, 8), size_dist(1, 1000), long_living_dist(0, 50);
+
+    const int num_boxes = 20000;
+    std::vector<Box> boxes;
+    for (int n = 0; n < num_boxes; n++) {
+        int length = long_living_dist(gen) == 0 ? 500 : length_dist(gen);
+        boxes.push_back({n / 2, n / 2 + length, size_dist(gen), n});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    auto begin = std::chrono::steady_clock::now();
+    const auto required = ms.solve();
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    // well under a second in practice, placement with a linear search of neighbours takes over ten seconds
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::seconds>(elapsed).count(), 5);
+    EXPECT_GE(required, ms.maxDepth());
+
+    // boxes alive at the same time stamp don't overlap
+    std::vector<std::vector<const Box*>> alive(num_boxes / 2 + 500 + 1);
+    for (const auto& box : boxes)
+        for (int t = box.start; t <= box.finish; t++)
+            alive[t].push_back(&box);
+    for (auto& at_time : alive) {
+        std::sort(at_time.begin(), at_time.end(), [&](const Box* l, const Box* r) {
+            return ms.getOffset(l->id) < ms.getOffset(r->id);
+        });
+        for (size_t i = 1; i < at_time.size(); i++)
+            ASSERT_LE(ms.getOffset(at_time[i - 1]->id) + at_time[i - 1]->size, ms.getOffset(at_time[i]->id))
+                << "Box overlapping is detected";
+        if (!at_time.empty())
+            ASSERT_LE(ms.getOffset(at_time.back()->id) + at_time.back()->size, required);
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using MKLDNNPlugin::SimpleDataHash;
+
+namespace {
+
+std::vector<unsigned char> makeData(size_t size) {
+    std::vector<unsigned char> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<unsigned char>(i * 131 + 7);
+    return data;
+}
+
+uint64_t hashOf(const std::string& str) {
+    return SimpleDataHash().hash(reinterpret_cast<const unsigned char*>(str.data()), str.size());
+}
+
+}  // namespace
+
+TEST(SimpleDataHashTest, MatchesXXHash64ForSmallBuffers) {
+    EXPECT_EQ(0xef46db3751d8e999ULL, hashOf(""));
+    EXPECT_EQ(0xd24ec4f1a98c6e5bULL, hashOf("a"));
+}
+
+TEST(SimpleDataHashTest, DependsOnEveryByte) {
+    // covers both single chunk and parallel multi-chunk modes
+    for (size_t size : {size_t{31}, size_t{4096}, size_t{(3 << 20) + 5}}) {
+        auto data = makeData(size);
+        const auto reference = SimpleDataHash().hash(data.data(), data.size());
+        EXPECT_EQ(reference, SimpleDataHash().hash(data.data(), data.size()));
+
+        for (size_t pos : {size_t{0}, size / 2, size - 1}) {
+            data[pos] ^= 1;
+            EXPECT_NE(reference, SimpleDataHash().hash(data.data(), data.size())) << "size " << size << " pos " << pos;
+            data[pos] ^= 1;
+        }
+        EXPECT_NE(reference, SimpleDataHash().hash(data.data(), data.size() - 1));
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+size_t countOf(const std::string& str, const std::string& what) {
+    size_t count = 0;
+    for (auto pos = str.find(what); pos != std::string::npos; pos = str.find(what, pos + what.size()))
+        count++;
+    return count;
+}
+
+}  // namespace
+
+TEST(PerfCountTest, PercentilesSeparateSlowIterations) {
+    PerfCount counter;
+    EXPECT_EQ(0, counter.percentile(0.5));
+
+    for (int i = 0; i < 90; i++) {
+        PerfHelper helper(counter);
+    }
+    for (int i = 0; i < 10; i++) {
+        PerfHelper helper(counter);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    EXPECT_LT(counter.percentile(0.5), 1000);
+    // bucket midpoints may underestimate a value by up to 1/8
+    EXPECT_GE(counter.percentile(0.99), 1750);
+    EXPECT_LE(counter.percentile(0.5), counter.avg());
+}
+
+TEST(PerfTraceTest, DumpsLatestEventsInChromeTraceFormat) {
+    PerfTrace trace(2);
+    const auto now = PerfTrace::TimePoint::clock::now();
+    trace.record(trace.intern("first"), 0, now, now + std::chrono::microseconds(5));
+    trace.record(trace.intern("second"), 1, now, now + std::chrono::microseconds(7));
+    trace.record(trace.intern("th\"ird"), 1, now, now + std::chrono::microseconds(9));
+
+    std::stringstream stream;
+    trace.dump(stream);
+    const auto json = stream.str();
+
+    EXPECT_EQ('[', json.front());
+    EXPECT_EQ(2, countOf(json, R"("ph":"X")"));
+    EXPECT_EQ(0, countOf(json, R"("name":"first")"));
+    EXPECT_EQ(1, countOf(json, R"("name":"second","cat":"CPU","ph":"X","pid":1,)"));
+    EXPECT_EQ(1, countOf(json, R"("name":"th\"ird")"));
+    EXPECT_EQ(1, countOf(json, R"("dur":9})"));
+}
+
+TEST(PerfTraceTest, RecordsFromSeveralThreads) {
+    PerfTrace trace;
+    auto recordEvents = [&trace] {
+        const auto name = trace.intern("node");
+        const auto now = PerfTrace::TimePoint::clock::now();
+        for (int i = 0; i < 100; i++)
+            trace.record(name, 0, now, now);
+    };
+    std::thread first(recordEvents), second(recordEvents);
+    first.join();
+    second.join();
+
+    std::stringstream stream;
+    trace.dump(stream);
+    EXPECT_EQ(200, countOf(stream.str(), R"("name":"node")"));
+}
+
+TEST(PerfTraceTest, KeepsNamesOfDestroyedNodes) {
+    PerfTrace trace;
+    const auto now = PerfTrace::TimePoint::clock::now();
+    {
+        std::string name = "node";
+        trace.record(trace.intern(name), 0, now, now);
+        EXPECT_EQ(trace.intern(name), trace.intern("node"));
+        name = "overwritten";
+    }
+
+    std::stringstream stream;
+    trace.dump(stream);
+    EXPECT_EQ(1, countOf(stream.str(), R"("name":"node")"));
+}
@@ -0,0 +1,197 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+// the plugin is built without MKL, so the reference BLAS routines are declared
+#ifndef _NO_MKL_
+#define _NO_MKL_
+#endif
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+#include "backend/dnn_types.h"
+
+namespace {
+
+std::vector<float> generate(size_t size, float shift) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<float>((i * 7 + 3) % 23) / 11.0f - shift;
+    }
+    return data;
+}
+
+void expect_near(const std::vector<float>& expected, const std::vector<float>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        // the blocked kernels sum the products in a different order
+        EXPECT_NEAR(expected[i], actual[i], 1e-4f * std::max(1.0f, std::fabs(expected[i]))) << "at " << i;
+    }
+}
+
+// M, N, K
+using GemmParams = std::tuple<int, int, int>;
+
+class GNAFloatMathTest : public ::testing::TestWithParam<GemmParams> {};
+
+TEST_P(GNAFloatMathTest, sgemmMatchesReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = generate(M * K, 1.0f);
+    auto B = generate(K * N, 0.5f);
+    auto C = generate(M * N, 0.25f);
+
+    auto expected = C;
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                expected[i * N + j] += A[i * K + k] * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N, 1.0f, C.data(), N);
+    expect_near(expected, C);
+}
+
+TEST_P(GNAFloatMathTest, sgemmTransposedBMatchesReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = generate(M * K, 1.0f);
+    auto B = generate(N * K, 0.5f);
+    auto C = generate(M * N, 0.25f);
+
+    auto expected = C;
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            float sum = 0.0f;
+            for (int k = 0; k < K; k++) {
+                sum += A[i * K + k] * B[j * K + k];
+            }
+            expected[i * N + j] = 0.5f * expected[i * N + j] + 2.0f * sum;
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, 2.0f, A.data(), K, B.data(), K, 0.5f, C.data(), N);
+    expect_near(expected, C);
+}
+
+TEST_P(GNAFloatMathTest, sgemmSubsetMatchesReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    std::vector<uint32_t> rows;
+    for (int i = M - 1; i >= 0; i -= 2) {
+        rows.push_back(i);
+    }
+    const int L = static_cast<int>(rows.size());
+    auto A = generate(M * K, 1.0f);
+    auto B = generate(K * N, 0.5f);
+    auto C = generate(L * N, 0.25f);
+
+    auto expected = C;
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                expected[l * N + j] += A[rows[l] * K + k] * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N, 1.0f,
+                       C.data(), N, rows.data(), L);
+    expect_near(expected, C);
+}
+
+TEST_P(GNAFloatMathTest, sgemvSplitMatchesReference) {
+    int N, K1, K2;
+    std::tie(N, K1, K2) = GetParam();
+    auto A1 = generate(K1, 1.0f);
+    auto A2 = generate(K2, 0.5f);
+    auto X = generate(N * (K1 + K2), 0.75f);
+    auto B = generate(N, 0.25f);
+    std::vector<float> C(N);
+
+    std::vector<float> expected(B);
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < K1 + K2; j++) {
+            expected[i] += (j < K1 ? A1[j] : A2[j - K1]) * X[i * (K1 + K2) + j];
+        }
+    }
+
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    expect_near(expected, C);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAFloatMathTest,
+                        ::testing::Values(GemmParams{1, 1, 1},
+                                          GemmParams{3, 1, 7},
+                                          GemmParams{4, 8, 16},
+                                          GemmParams{13, 3, 37},
+                                          GemmParams{64, 1, 600},
+                                          GemmParams{130, 8, 1030}));
+
+// filters, filter rows, feature maps, feature map columns, feature map rows
+using CNNFilterParams = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t>;
+
+class GNACNNFilter32Test : public ::testing::TestWithParam<CNNFilterParams> {};
+
+TEST_P(GNACNNFilter32Test, matchesDirectLoop) {
+    uint32_t num_filters, num_filter_rows, num_feature_maps, num_feature_map_columns, num_feature_map_rows;
+    std::tie(num_filters, num_filter_rows, num_feature_maps, num_feature_map_columns, num_feature_map_rows) = GetParam();
+    // windows of consecutive outputs overlap, as the band stride is less than the filter length
+    const uint32_t band_stride = num_feature_maps * num_feature_map_columns;
+    const uint32_t num_filter_coefficients = num_filter_rows * band_stride;
+    const uint32_t num_filter_outputs = num_feature_map_rows - num_filter_rows + 1;
+    auto inputs = generate(num_feature_map_rows * band_stride, 1.0f);
+    auto filters = generate(num_filters * num_filter_coefficients, 0.5f);
+    auto biases = generate(num_filters, 0.25f);
+    std::vector<float> outputs(num_filter_outputs * num_filters);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_columns_in = static_cast<uint32_t>(inputs.size());
+    component.num_rows_out = 1;
+    component.num_columns_out = static_cast<uint32_t>(outputs.size());
+    component.op.conv1D.num_filters = num_filters;
+    component.op.conv1D.num_filter_rows = num_filter_rows;
+    component.op.conv1D.num_filter_coefficients = num_filter_coefficients;
+    component.op.conv1D.num_feature_maps = num_feature_maps;
+    component.op.conv1D.num_feature_map_rows = num_feature_map_rows;
+    component.op.conv1D.num_feature_map_columns = num_feature_map_columns;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.original_layer_name = "conv";
+
+    // the loop CNNFilter32 used before it was expressed as a GEMM
+    std::vector<float> expected(outputs.size());
+    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+        const float *ptr_in = inputs.data() + j * band_stride;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const float *ptr_coef = filters.data() + i * num_filter_coefficients;
+            float sum = biases[i];
+            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
+                sum += ptr_in[k] * ptr_coef[k];
+            }
+            expected[j * num_filters + i] = sum;
+        }
+    }
+
+    CNNFilter32(&component);
+    expect_near(expected, outputs);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNACNNFilter32Test,
+                        ::testing::Values(CNNFilterParams{1, 1, 1, 1, 1},
+                                          CNNFilterParams{4, 2, 1, 3, 9},
+                                          CNNFilterParams{8, 3, 2, 8, 20},
+                                          CNNFilterParams{5, 8, 1, 16, 8},
+                                          CNNFilterParams{32, 5, 4, 10, 64}));
+
+}  // namespace
@@ -0,0 +1,155 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/attribute_adapter.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset5.hpp>
+
+#include "compilation_context.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// an attribute which is visited through the generic adapter only
+struct OpaqueAttribute {};
+
+}  // namespace
+
+namespace ngraph {
+
+template <>
+class AttributeAdapter<OpaqueAttribute> : public ValueAccessor<void> {
+public:
+    explicit AttributeAdapter(OpaqueAttribute&) {}
+    static constexpr DiscreteTypeInfo type_info{"AttributeAdapter<OpaqueAttribute>", 0};
+    const DiscreteTypeInfo& get_type_info() const override { return type_info; }
+};
+
+constexpr DiscreteTypeInfo AttributeAdapter<OpaqueAttribute>::type_info;
+
+}  // namespace ngraph
+
+namespace {
+
+CNNNetwork createNetwork(float weight, const std::string& name = "add") {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    param->set_friendly_name("input");
+    auto constant = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1},
+                                                     std::vector<float>{weight, 2.f, 3.f});
+    auto add = std::make_shared<ngraph::opset5::Add>(param, constant);
+    add->set_friendly_name(name);
+    auto result = std::make_shared<ngraph::opset5::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+CNNNetwork createNetwork(const ngraph::op::AutoBroadcastSpec& broadcast) {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto constant = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1.f, 2.f, 3.f});
+    auto add = std::make_shared<ngraph::opset5::Add>(param, constant, broadcast);
+    auto result = std::make_shared<ngraph::opset5::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+template <typename T>
+class AttributeOp : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"AttributeOp", 0};
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    AttributeOp(const ngraph::Output<ngraph::Node>& arg, const T& value) : Op({arg}), _value(value) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override {
+        return std::make_shared<AttributeOp>(new_args.at(0), _value);
+    }
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override {
+        visitor.on_attribute("value", _value);
+        return true;
+    }
+
+private:
+    T _value;
+};
+
+template <typename T>
+constexpr ngraph::NodeTypeInfo AttributeOp<T>::type_info;
+
+template <typename T>
+CNNNetwork createAttributeNetwork(const T& value) {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto op = std::make_shared<AttributeOp<T>>(param, value);
+    auto result = std::make_shared<ngraph::opset5::Result>(op);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+}  // namespace
+
+TEST(CompilationContextTests, sameNetworkHasSameHash) {
+    auto hash1 = ComputeNetworkHash(createNetwork(1.f), {{"DEVICE_NAME", "CPU"}});
+    auto hash2 = ComputeNetworkHash(createNetwork(1.f), {{"DEVICE_NAME", "CPU"}});
+    ASSERT_FALSE(hash1.empty());
+    ASSERT_EQ(hash1, hash2);
+}
+
+TEST(CompilationContextTests, hashDependsOnConstantData) {
+    ASSERT_NE(ComputeNetworkHash(createNetwork(1.f), {}), ComputeNetworkHash(createNetwork(5.f), {}));
+}
+
+TEST(CompilationContextTests, hashDependsOnNodeNames) {
+    ASSERT_NE(ComputeNetworkHash(createNetwork(1.f, "add"), {}), ComputeNetworkHash(createNetwork(1.f, "sum"), {}));
+}
+
+TEST(CompilationContextTests, hashDependsOnCompileOptions) {
+    ASSERT_NE(ComputeNetworkHash(createNetwork(1.f), {{"DEVICE_NAME", "CPU"}}),
+              ComputeNetworkHash(createNetwork(1.f), {{"DEVICE_NAME", "GPU"}}));
+}
+
+TEST(CompilationContextTests, hashDependsOnInputPrecision) {
+    auto network = createNetwork(1.f);
+    auto hash1 = ComputeNetworkHash(network, {});
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    ASSERT_NE(hash1, ComputeNetworkHash(network, {}));
+}
+
+TEST(CompilationContextTests, hashDependsOnPreprocessing) {
+    auto network = createNetwork(1.f);
+    auto hash1 = ComputeNetworkHash(network, {});
+    network.getInputsInfo().begin()->second->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+    ASSERT_NE(hash1, ComputeNetworkHash(network, {}));
+}
+
+TEST(CompilationContextTests, hashDependsOnBroadcastSpec) {
+    ASSERT_NE(ComputeNetworkHash(createNetwork(ngraph::op::AutoBroadcastType::NONE), {}),
+              ComputeNetworkHash(createNetwork(ngraph::op::AutoBroadcastType::NUMPY), {}));
+}
+
+TEST(CompilationContextTests, hashDependsOnTypedAttributeValues) {
+    ASSERT_NE(ComputeNetworkHash(createAttributeNetwork(ngraph::element::f16), {}),
+              ComputeNetworkHash(createAttributeNetwork(ngraph::element::bf16), {}));
+    ASSERT_NE(ComputeNetworkHash(createAttributeNetwork(std::vector<double>{0.5, 1.0}), {}),
+              ComputeNetworkHash(createAttributeNetwork(std::vector<double>{0.5, 2.0}), {}));
+    ASSERT_NE(ComputeNetworkHash(createAttributeNetwork(uint8_t{1}), {}),
+              ComputeNetworkHash(createAttributeNetwork(uint8_t{2}), {}));
+    ASSERT_NE(ComputeNetworkHash(createAttributeNetwork(std::vector<int16_t>{1, 2}), {}),
+              ComputeNetworkHash(createAttributeNetwork(std::vector<int16_t>{1, 3}), {}));
+}
+
+TEST(CompilationContextTests, networkWithOpaqueAttributeIsNotHashed) {
+    ASSERT_TRUE(ComputeNetworkHash(createAttributeNetwork(OpaqueAttribute{}), {}).empty());
+}
@@ -425,3 +425,30 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+TEST(ROIBatchedBlobTests, canCreateROIBatchedBlobFromImage) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    image->allocate();
+    auto blob = make_shared_blob<ROIBatchedBlob>(image, std::vector<ROI>{{0, 0, 0, 4, 2}, {0, 2, 3, 5, 3}});
+
+    EXPECT_EQ(2, blob->size());
+    EXPECT_EQ(SizeVector({2, 3, 6, 8}), blob->getTensorDesc().getDims());
+    EXPECT_EQ(NHWC, blob->getTensorDesc().getLayout());
+    EXPECT_EQ(SizeVector({1, 3, 3, 5}), blob->getBlob(1)->getTensorDesc().getDims());
+    EXPECT_EQ(image->buffer().as<uint8_t*>() + (3 * 8 + 2) * 3,
+              blob->getBlob(1)->buffer().as<uint8_t*>() +
+              blob->getBlob(1)->getTensorDesc().getBlockingDesc().getOffsetPadding());
+}
+
+TEST(ROIBatchedBlobTests, cannotCreateROIBatchedBlobFromInvalidImage) {
+    const std::vector<ROI> rois = {{0, 0, 0, 2, 2}};
+    Blob::Ptr batched = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 6, 8}, NCHW));
+    batched->allocate();
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NCHW));
+    image->allocate();
+
+    EXPECT_THROW(make_shared_blob<ROIBatchedBlob>(nullptr, rois), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<ROIBatchedBlob>(batched, rois), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<ROIBatchedBlob>(image, std::vector<ROI>{}),
+                 InferenceEngine::details::InferenceEngineException);
+}
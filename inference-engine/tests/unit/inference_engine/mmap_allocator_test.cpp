@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MmapAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        data.resize(4096 + 13);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<char>(i % 251);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(data.data(), data.size());
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    const std::string fileName = "mmap_allocator_test.bin";
+    std::vector<char> data;
+};
+
+TEST_F(MmapAllocatorTests, canMapFile) {
+    auto allocator = details::shared_from_irelease(details::CreateMmapAllocator(fileName));
+    ASSERT_NE(allocator, nullptr);
+
+    void* handle = allocator->alloc(data.size());
+    ASSERT_NE(handle, nullptr);
+    auto ptr = static_cast<char*>(allocator->lock(handle, LOCK_FOR_READ));
+    EXPECT_EQ(std::vector<char>(ptr, ptr + data.size()), data);
+    allocator->unlock(handle);
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, failsToMapMoreThanFileSize) {
+    auto allocator = details::shared_from_irelease(details::CreateMmapAllocator(fileName));
+    ASSERT_NE(allocator, nullptr);
+    EXPECT_EQ(allocator->alloc(data.size() + 1), nullptr);
+}
+
+TEST_F(MmapAllocatorTests, failsToMapNotExistingFile) {
+    auto allocator = details::shared_from_irelease(details::CreateMmapAllocator("not_existing_file.bin"));
+    ASSERT_NE(allocator, nullptr);
+    EXPECT_EQ(allocator->alloc(data.size()), nullptr);
+}
+
+TEST_F(MmapAllocatorTests, writeToBlobDoesNotChangeFile) {
+    auto allocator = details::shared_from_irelease(details::CreateMmapAllocator(fileName));
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, { data.size() }, C }, allocator);
+    blob->allocate();
+    ASSERT_NE(blob->buffer().as<uint8_t*>(), nullptr);
+
+    blob->buffer().as<uint8_t*>()[0] = 255;
+    EXPECT_EQ(blob->cbuffer().as<const uint8_t*>()[0], 255);
+    blob.reset();
+
+    std::ifstream file(fileName, std::ios::binary);
+    EXPECT_EQ(file.get(), static_cast<unsigned char>(data[0]));
+}
@@ -73,6 +73,8 @@ cv::String interpToString(int interp)
     case cv::INTER_AREA   : return "INTER_AREA";
     case cv::INTER_LINEAR : return "INTER_LINEAR";
     case cv::INTER_NEAREST: return "INTER_NEAREST";
+    case cv::INTER_CUBIC  : return "INTER_CUBIC";
+    case cv::INTER_LANCZOS4: return "INTER_LANCZOS4";
     }
     CV_Assert(!"ERROR: unsupported interpolation!");
     return nullptr;
@@ -687,7 +689,8 @@ TEST_P(ResizeTestIE, AccuracyTest)
     int depth = CV_MAT_DEPTH(type);
     CV_Assert(CV_8U == depth || CV_32F == depth);
 
-    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp ||
+              cv::INTER_CUBIC == interp || cv::INTER_LANCZOS4 == interp);
 
     ASSERT_TRUE(in_mat1.isContinuous() && out_mat.isContinuous());
 
@@ -710,7 +713,14 @@ TEST_P(ResizeTestIE, AccuracyTest)
     PreProcessDataPtr preprocess = CreatePreprocDataHelper();
     preprocess->setRoiBlob(in_blob);
 
-    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
+    ResizeAlgorithm algorithm = [&] {
+        switch (interp) {
+        case cv::INTER_AREA:     return RESIZE_AREA;
+        case cv::INTER_CUBIC:    return RESIZE_BICUBIC;
+        case cv::INTER_LANCZOS4: return RESIZE_LANCZOS4;
+        default:                 return RESIZE_BILINEAR;
+        }
+    }();
     PreProcessInfo info;
     info.setResizeAlgorithm(algorithm);
 
@@ -1189,7 +1199,9 @@ TEST_P(PreprocTest, Performance)
         cv::cvtColorTwoPlane(ocv_out_mat, in_mat2, ocv_out_mat, toCvtColorCode(in_fmt, out_fmt));
     }
 
-    auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
+    auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA
+        : interp == RESIZE_BICUBIC ? cv::INTER_CUBIC
+        : interp == RESIZE_LANCZOS4 ? cv::INTER_LANCZOS4 : cv::INTER_LINEAR;
     cv::resize(ocv_out_mat, ocv_out_mat, out_size, 0, 0, cv_interp);
 
     if (in_prec != out_prec) {
@@ -1205,7 +1217,9 @@ TEST_P(PreprocTest, Performance)
     const auto in_type_str  = depthToString(precision_to_depth(in_prec));
     const auto out_type_str = depthToString(precision_to_depth(out_prec));
     const auto interp_str = interp == RESIZE_AREA ? "AREA"
-        : interp == RESIZE_BILINEAR ? "BILINEAR" : "?";
+        : interp == RESIZE_BILINEAR ? "BILINEAR"
+        : interp == RESIZE_BICUBIC ? "BICUBIC"
+        : interp == RESIZE_LANCZOS4 ? "LANCZOS4" : "?";
     const auto in_layout_str = layoutToString(in_layout);
     const auto out_layout_str = layoutToString(out_layout);
 
@@ -129,6 +129,18 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestGAPI,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.015))); // accuracy like ~1.5%
 
+INSTANTIATE_TEST_CASE_P(ResizeSeparableTestFluid_U8, ResizeTestGAPI,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_CUBIC, cv::INTER_LANCZOS4),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(2))); // error not more than 2 units
+
+INSTANTIATE_TEST_CASE_P(ResizeSeparableTestFluid_F32, ResizeTestGAPI,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_CUBIC, cv::INTER_LANCZOS4),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.015))); // accuracy like ~1.5%
+
 
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestGAPI,
                         Combine(Values(2, 3, 4),
@@ -225,6 +237,18 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_CASE_P(ResizeSeparableTestFluid_U8, ResizeTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_CUBIC, cv::INTER_LANCZOS4),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(2))); // error not more than 2 units
+
+INSTANTIATE_TEST_CASE_P(ResizeSeparableTestFluid_F32, ResizeTestIE,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_CUBIC, cv::INTER_LANCZOS4),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05))); // error within 0.05 units
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
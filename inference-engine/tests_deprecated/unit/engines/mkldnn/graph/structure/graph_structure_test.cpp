@@ -6692,3 +6692,72 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     compare(*outputBlobs["concat"], *dstOut);
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestInferRequestBindsI32BlobsWithoutCopy) {
+    std::shared_ptr<ngraph::Function> function;
+    {
+        ngraph::element::Type elementType = ngraph::element::Type_t::i32;
+        ngraph::Shape shape { 1, 3, 4, 5 };
+        auto a = std::make_shared<ngraph::op::Parameter>(elementType, shape);
+        a->set_friendly_name("a");
+        auto b = std::make_shared<ngraph::op::Parameter>(elementType, shape);
+        b->set_friendly_name("b");
+        auto sum = std::make_shared<ngraph::op::v1::Add>(a, b);
+        sum->set_friendly_name("sum");
+        auto result = std::make_shared<ngraph::op::Result>(sum);
+
+        ngraph::ResultVector results { result };
+        ngraph::ParameterVector params { a, b };
+        function = std::make_shared<ngraph::Function>(results, params);
+    }
+
+    InferenceEngine::CNNNetwork network(function);
+    for (auto& input : network.getInputsInfo())
+        input.second->setPrecision(InferenceEngine::Precision::I32);
+    network.getOutputsInfo()["sum"]->setPrecision(InferenceEngine::Precision::I32);
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(network, {}, {}, cache));
+    execNetwork->setNetworkInputs(network.getInputsInfo());
+    execNetwork->setNetworkOutputs(network.getOutputsInfo());
+    InferenceEngine::IInferRequest::Ptr inferRequest = execNetwork->CreateInferRequest();
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::I32, {1, 3, 4, 5}, InferenceEngine::NCHW);
+    InferenceEngine::BlobMap blobs;
+    for (const char* name : {"a", "b", "sum"}) {
+        blobs[name] = InferenceEngine::make_shared_blob<int32_t>(desc);
+        blobs[name]->allocate();
+    }
+    auto a = blobs["a"]->buffer().as<int32_t*>();
+    auto b = blobs["b"]->buffer().as<int32_t*>();
+    for (size_t i = 0; i < desc.getDims()[1] * desc.getDims()[2] * desc.getDims()[3]; i++) {
+        a[i] = static_cast<int32_t>(i) - 30;
+        b[i] = 1000 * static_cast<int32_t>(i);
+    }
+
+    InferenceEngine::ResponseDesc resp;
+    for (auto& blob : blobs) {
+        InferenceEngine::StatusCode sts = inferRequest->SetBlob(blob.first.c_str(), blob.second, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+    }
+    InferenceEngine::StatusCode sts = inferRequest->Infer(&resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    auto sum = blobs["sum"]->buffer().as<int32_t*>();
+    for (size_t i = 0; i < blobs["sum"]->size(); i++)
+        ASSERT_EQ(a[i] + b[i], sum[i]) << "element " << i;
+
+    // the graph reads and writes the blobs of the request directly
+    auto graph = execNetwork->_graphs.begin()->get();
+    for (const char* name : {"a", "b"}) {
+        auto input = graph->GetInputNodes().find(name);
+        ASSERT_NE(graph->GetInputNodes().end(), input);
+        ASSERT_EQ(blobs[name]->buffer().as<void*>(), input->second->getChildEdgeAt(0)->getMemory().GetData()) << name;
+    }
+    MKLDNNPlugin::MKLDNNNodePtr output;
+    for (auto& node : graph->GetOutputNodes()) {
+        if (node->getName() == "out_sum")
+            output = node;
+    }
+    ASSERT_NE(nullptr, output);
+    ASSERT_EQ(blobs["sum"]->buffer().as<void*>(), output->getParentEdgeAt(0)->getMemory().GetData());
+}
@@ -111,6 +111,8 @@ namespace ngraph
             Output* m_output;
 
         private:
+            void invalidate_ordered_ops();
+
             bool m_is_relevant_to_shape;
             bool m_is_relevant_to_value;
         };
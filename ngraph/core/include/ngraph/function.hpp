@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -187,6 +188,30 @@ namespace ngraph
         // These nodes are not outputs of graph but should not be removed even if have no children.
         SinkVector m_sinks;
         ParameterVector m_parameters;
+
+        /// \brief get_ordered_ops() result. Ordered nodes and the function change the version
+        /// on every modification of the graph, the nodes are kept alive by the graph until that.
+        struct OrderedOpsCache
+        {
+            OrderedOpsCache() = default;
+            // a copy has to be ordered and registered in nodes on its own
+            OrderedOpsCache(const OrderedOpsCache&) {}
+            OrderedOpsCache& operator=(const OrderedOpsCache&)
+            {
+                valid = false;
+                ops.clear();
+                return *this;
+            }
+
+            std::mutex mutex;
+            std::shared_ptr<std::atomic<size_t>> version{std::make_shared<std::atomic<size_t>>(0)};
+            std::vector<Node*> ops;
+            size_t ops_version{0};
+            bool valid{false};
+        };
+        mutable OrderedOpsCache m_ordered_ops_cache;
+
+        void invalidate_ordered_ops();
     };
 
     template <>
@@ -133,6 +133,9 @@ namespace ngraph
         // For access to m_outputs.
         friend class descriptor::Input;
 
+        // For access to ordered ops versions.
+        friend class Function;
+
         // For access to m_inputs and m_outputs.
         template <typename NodeType>
         friend class Input;
@@ -468,6 +471,14 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Bumps versions of ordered ops of functions this node was ordered in. Must be
+        /// called on every change of node inputs and control dependencies.
+        void invalidate_ordered_ops();
+        /// \brief Makes nodes invalidate ordered ops with the given version.
+        static void register_ordered_ops_version(
+            const std::vector<std::shared_ptr<Node>>& nodes,
+            const std::shared_ptr<std::atomic<size_t>>& version);
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -477,6 +488,8 @@ namespace ngraph
         static std::atomic<size_t> m_next_instance_id;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
+        // Inputs invalidate ordered ops on destruction, so versions must outlive them
+        std::vector<std::weak_ptr<std::atomic<size_t>>> m_ordered_ops_versions;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
@@ -19,8 +19,10 @@
 #include <cstddef>
 
 #include <utility>
+#include <vector>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -68,25 +70,70 @@ namespace ngraph
                                                       const size_t stride,
                                                       Functor elementwise_functor)
                 {
-                    for (CoordinateIterator it(output_shape), ite = CoordinateIterator::end();;)
+                    // The output is processed by rows of `stride` elements. A row is addressed
+                    // by output coordinates [0, axis] and starts in every input at the sum of
+                    // its coordinates multiplied by input strides of the non-broadcasted axes.
+                    if (stride == 0)
                     {
-                        for (size_t i = 0; i < stride; ++i)
-                            *out++ = elementwise_functor(arg0[i * A0], arg1[i * A1]);
-
-                        arg0 += A0 ? stride : 1;
-                        arg1 += A1 ? stride : 1;
+                        return;
+                    }
+                    std::vector<size_t> row_strides0(axis + 1), row_strides1(axis + 1);
+                    size_t rows = 1;
+                    for (size_t i = 0; i <= axis; ++i)
+                    {
+                        row_strides0[i] =
+                            value_with_padding_or(shape0, padding0, i, 1) == 1 ? 0 : strides0[i];
+                        row_strides1[i] =
+                            value_with_padding_or(shape1, padding1, i, 1) == 1 ? 0 : strides1[i];
+                        rows *= output_shape[i];
+                    }
 
-                        auto p = it.advance(axis);
+                    auto process_rows = [&](size_t begin, size_t end) {
+                        std::vector<size_t> coord(axis + 1);
+                        size_t offset0 = 0;
+                        size_t offset1 = 0;
+                        for (size_t i = axis + 1, row = begin; i-- > 0;)
+                        {
+                            coord[i] = row % output_shape[i];
+                            row /= output_shape[i];
+                            offset0 += coord[i] * row_strides0[i];
+                            offset1 += coord[i] * row_strides1[i];
+                        }
 
-                        if (it == ite)
-                            break;
+                        U* dst = out + begin * stride;
+                        for (size_t row = begin; row < end; ++row, dst += stride)
+                        {
+                            const T* src0 = arg0 + offset0;
+                            const T* src1 = arg1 + offset1;
+                            for (size_t i = 0; i < stride; ++i)
+                                dst[i] = elementwise_functor(src0[i * A0], src1[i * A1]);
 
-                        if (value_with_padding_or(shape0, padding0, p, 1) == 1)
-                            arg0 -= strides0[p];
+                            for (size_t i = axis + 1; i-- > 0;)
+                            {
+                                if (++coord[i] < output_shape[i])
+                                {
+                                    offset0 += row_strides0[i];
+                                    offset1 += row_strides1[i];
+                                    break;
+                                }
+                                coord[i] = 0;
+                                offset0 -= (output_shape[i] - 1) * row_strides0[i];
+                                offset1 -= (output_shape[i] - 1) * row_strides1[i];
+                            }
+                        }
+                    };
+                    parallel_for(
+                        rows, std::max<size_t>(elementwise_grain_size / stride, 1), process_rows);
+                }
 
-                        if (value_with_padding_or(shape1, padding1, p, 1) == 1)
-                            arg1 -= strides1[p];
-                    }
+                template <typename T, typename U, typename Functor>
+                inline void elementwise_binop(
+                    const T* arg0, const T* arg1, U* out, size_t count, Functor elementwise_functor)
+                {
+                    parallel_for(count, elementwise_grain_size, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i)
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                    });
                 }
 
                 inline size_t calculate_fixed_axis(size_t axis, const size_t* strides)
@@ -126,10 +173,8 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    internal::elementwise_binop(
+                        arg0, arg1, out, shape_size(arg0_shape), elementwise_functor);
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -205,8 +250,7 @@ namespace ngraph
 
                         if (axis == 0)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            elementwise_binop(arg0, arg1, out, strides0[0], elementwise_functor);
                         }
                         else if (strides0[axis] == 1 &&
                                  value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
@@ -39,6 +39,19 @@ namespace ngraph
                       const AxisSet& reduction_axes,
                       bool keep_dims)
             {
+                size_t outer, reduced, inner;
+                if (internal::split_contiguous_reduction(
+                        in_shape, reduction_axes, outer, reduced, inner))
+                {
+                    internal::sum_contiguous(arg, out, outer, reduced, inner);
+                    const int count = static_cast<int>(reduced);
+                    for (size_t i = 0; i < outer * inner; ++i)
+                    {
+                        out[i] = out[i] / count;
+                    }
+                    return;
+                }
+
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
                 CoordinateTransform output_transform(out_shape);
                 std::vector<T> cs(shape_size(out_shape));
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Returns the number of threads the reference kernels may use.
+            ///
+            /// Defaults to the number of CPUs available to the process and can be overridden
+            /// with the NGRAPH_REFERENCE_THREADS environment variable (1 disables parallel
+            /// execution).
+            size_t get_parallel_threads();
+
+            /// \brief Splits the range [0, work_amount) into contiguous chunks and calls
+            ///        func(begin, end) for every chunk.
+            ///
+            /// Chunks are processed by the calling thread and a pool of threads created once.
+            /// No more threads than CPUs the calling thread may run on are used. The whole range
+            /// is processed by the calling thread if it holds less than two grains, when called
+            /// from inside another parallel_for or while the pool is busy with a call from
+            /// another thread. The first exception thrown by func is rethrown to the caller
+            /// once all chunks are finished.
+            ///
+            /// \param work_amount Number of items to process.
+            /// \param grain_size Minimal number of items worth processing in a separate thread.
+            /// \param func Functor processing items [begin, end).
+            void parallel_for(size_t work_amount,
+                              size_t grain_size,
+                              const std::function<void(size_t, size_t)>& func);
+
+            /// \brief Default grain size for cheap elementwise kernels.
+            constexpr size_t elementwise_grain_size = 1 << 16;
+        }
+    }
+}
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <numeric>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,6 +57,76 @@ namespace ngraph
                 return true;
             }
 
+            namespace internal
+            {
+                /// \brief Checks if the reduction axes form a single contiguous range and splits
+                ///        the input shape into outer, reduced and inner parts around it.
+                inline bool split_contiguous_reduction(const Shape& in_shape,
+                                                       const AxisSet& reduction_axes,
+                                                       size_t& outer,
+                                                       size_t& reduced,
+                                                       size_t& inner)
+                {
+                    if (reduction_axes.empty() || *reduction_axes.rbegin() >= in_shape.size() ||
+                        *reduction_axes.rbegin() - *reduction_axes.begin() + 1 !=
+                            reduction_axes.size())
+                    {
+                        return false;
+                    }
+                    const auto first = in_shape.begin() + *reduction_axes.begin();
+                    const auto last = in_shape.begin() + *reduction_axes.rbegin() + 1;
+                    outer = std::accumulate(
+                        in_shape.begin(), first, size_t(1), std::multiplies<size_t>());
+                    reduced = std::accumulate(first, last, size_t(1), std::multiplies<size_t>());
+                    inner =
+                        std::accumulate(last, in_shape.end(), size_t(1), std::multiplies<size_t>());
+                    return true;
+                }
+
+                /// \brief Kahan summation of a [outer, reduced, inner] tensor over its middle
+                ///        axis. Each output is accumulated in the same order as by the generic
+                ///        implementation, while the innermost loop runs over contiguous memory.
+                template <typename T>
+                void sum_contiguous(
+                    const T* arg, T* out, size_t outer, size_t reduced, size_t inner)
+                {
+                    const size_t grain_size =
+                        std::max<size_t>(elementwise_grain_size / std::max<size_t>(reduced, 1), 1);
+                    parallel_for(outer * inner, grain_size, [&](size_t begin, size_t end) {
+                        std::vector<T> cs(std::min(end - begin, inner));
+                        for (size_t o = begin / inner; o * inner < end; ++o)
+                        {
+                            const size_t i_begin = std::max(begin, o * inner) - o * inner;
+                            const size_t i_end = std::min(end, (o + 1) * inner) - o * inner;
+                            T* z = out + o * inner;
+                            for (size_t i = i_begin; i < i_end; ++i)
+                            {
+                                z[i] = 0;
+                                cs[i - i_begin] = 0;
+                            }
+                            for (size_t r = 0; r < reduced; ++r)
+                            {
+                                const T* x = arg + (o * reduced + r) * inner;
+                                for (size_t i = i_begin; i < i_end; ++i)
+                                {
+                                    if (is_finite(x[i]) && is_finite(z[i]))
+                                    {
+                                        T& c = cs[i - i_begin];
+                                        T t = z[i] + (x[i] - c);
+                                        c = (t - z[i]) - (x[i] - c);
+                                        z[i] = t;
+                                    }
+                                    else
+                                    {
+                                        z[i] = z[i] + x[i];
+                                    }
+                                }
+                            }
+                        }
+                    });
+                }
+            }
+
             template <typename T>
             void sum(const T* arg,
                      T* out,
@@ -59,6 +134,14 @@ namespace ngraph
                      const AxisSet& reduction_axes,
                      bool keep_dims)
             {
+                size_t outer, reduced, inner;
+                if (internal::split_contiguous_reduction(
+                        in_shape, reduction_axes, outer, reduced, inner))
+                {
+                    internal::sum_contiguous(arg, out, outer, reduced, inner);
+                    return;
+                }
+
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
                 CoordinateTransform output_transform(out_shape);
                 std::vector<T> cs(shape_size(out_shape));
@@ -14,11 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cmath>
 #include <stdio.h>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 
 using namespace ngraph;
 
@@ -29,7 +31,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         memcpy(out, in, elem_size);
     }
@@ -39,7 +43,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[1];
         size_t in_index[1];
@@ -49,7 +55,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             memcpy(out, in + *map_index[0] * elem_size, elem_size);
             out += elem_size;
@@ -61,7 +67,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[2];
         size_t in_index[2];
@@ -71,7 +79,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -91,7 +99,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[3];
         size_t in_index[3];
@@ -101,7 +111,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -125,7 +135,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[4];
         size_t in_index[4];
@@ -135,7 +147,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -163,7 +175,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[5];
         size_t in_index[5];
@@ -173,7 +187,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -205,7 +219,9 @@ namespace
                      const Shape& in_shape,
                      const AxisVector& in_axis_order,
                      const Shape& out_shape,
-                     size_t elem_size)
+                     size_t elem_size,
+                     size_t begin,
+                     size_t end)
     {
         size_t size[6];
         size_t in_index[6];
@@ -215,7 +231,7 @@ namespace
             size[i] = in_shape[in_axis_order[i]];
             map_index[in_axis_order[i]] = &in_index[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (in_index[0] = begin; in_index[0] < end; ++in_index[0])
         {
             for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
             {
@@ -253,15 +269,44 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
+    using reshape_kernel = void (*)(const char*,
+                                    char*,
+                                    const Shape&,
+                                    const AxisVector&,
+                                    const Shape&,
+                                    size_t,
+                                    size_t,
+                                    size_t);
+    reshape_kernel kernel = nullptr;
     switch (in_shape.size())
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+    case 0: kernel = reshape_in0; break;
+    case 1: kernel = reshape_in1; break;
+    case 2: kernel = reshape_in2; break;
+    case 3: kernel = reshape_in3; break;
+    case 4: kernel = reshape_in4; break;
+    case 5: kernel = reshape_in5; break;
+    case 6: kernel = reshape_in6; break;
+    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); return;
     }
+
+    // output rows along the outermost axis are independent and copied in parallel
+    const size_t rows = in_shape.empty() ? 1 : in_shape[in_axis_order[0]];
+    if (rows == 0)
+    {
+        return;
+    }
+    const size_t row_elements = shape_size(in_shape) / rows;
+    const size_t grain_size =
+        std::max<size_t>(reference::elementwise_grain_size / std::max<size_t>(row_elements, 1), 1);
+    reference::parallel_for(rows, grain_size, [&](size_t begin, size_t end) {
+        kernel(in,
+               out + begin * row_elements * elem_size,
+               in_shape,
+               in_axis_order,
+               out_shape,
+               elem_size,
+               begin,
+               end);
+    });
 }
@@ -0,0 +1,238 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace
+            {
+                thread_local bool in_parallel_region = false;
+
+                class ParallelRegionGuard
+                {
+                public:
+                    ParallelRegionGuard() { in_parallel_region = true; }
+                    ~ParallelRegionGuard() { in_parallel_region = false; }
+                };
+
+                /// Number of CPUs the calling thread may run on: a process or a thread pinned
+                /// by its owner (taskset, containers, streams of a plugin) gets no more threads.
+                size_t available_cpus()
+                {
+#ifdef __linux__
+                    cpu_set_t mask;
+                    CPU_ZERO(&mask);
+                    if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+                    {
+                        return std::max(1, CPU_COUNT(&mask));
+                    }
+#endif
+                    return std::max(1u, std::thread::hardware_concurrency());
+                }
+
+                /// Chunks of one parallel_for call. Chunks are claimed one by one by the
+                /// calling thread and pool workers.
+                struct Job
+                {
+                    Job(const std::function<void(size_t, size_t)>& func,
+                        size_t work_amount,
+                        size_t chunks)
+                        : func(func)
+                        , work_amount(work_amount)
+                        , chunks(chunks)
+                        , errors(chunks)
+                    {
+                    }
+
+                    size_t chunk_begin(size_t chunk) const
+                    {
+                        return work_amount * chunk / chunks;
+                    }
+
+                    bool has_chunks() const { return next_chunk.load() < chunks; }
+                    void run_chunks()
+                    {
+                        ParallelRegionGuard guard;
+                        for (size_t chunk = next_chunk++; chunk < chunks; chunk = next_chunk++)
+                        {
+                            try
+                            {
+                                func(chunk_begin(chunk), chunk_begin(chunk + 1));
+                            }
+                            catch (...)
+                            {
+                                errors[chunk] = std::current_exception();
+                            }
+                        }
+                    }
+
+                    const std::function<void(size_t, size_t)>& func;
+                    const size_t work_amount;
+                    const size_t chunks;
+                    std::vector<std::exception_ptr> errors;
+                    std::atomic<size_t> next_chunk{0};
+                    // guarded by the pool mutex
+                    size_t workers = 0;
+                };
+
+                /// Threads created on first use and reused by all parallel_for calls. The pool
+                /// runs one job at a time, so reference kernels never use more threads than
+                /// get_parallel_threads() even if they are called from several threads.
+                class WorkerPool
+                {
+                public:
+                    static WorkerPool& get()
+                    {
+                        // Never destroyed: joining threads from static destructors may deadlock
+                        // when the library is unloaded. Idle workers just wait for a job.
+                        static WorkerPool* pool = new WorkerPool(get_parallel_threads() - 1);
+                        return *pool;
+                    }
+
+                    /// Runs the job by the calling thread and up to max_workers pool threads.
+                    /// Returns false without running anything if the pool is busy.
+                    bool run(Job& job, size_t max_workers)
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        if (m_job != nullptr)
+                        {
+                            return false;
+                        }
+                        m_job = &job;
+                        m_max_workers = max_workers;
+                        lock.unlock();
+                        m_job_ready.notify_all();
+
+                        job.run_chunks();
+
+                        lock.lock();
+                        m_job = nullptr;
+                        m_job_done.wait(lock, [&] { return job.workers == 0; });
+                        return true;
+                    }
+
+                private:
+                    explicit WorkerPool(size_t workers)
+                    {
+                        try
+                        {
+                            for (size_t i = 0; i < workers; ++i)
+                            {
+                                std::thread([this] { work(); }).detach();
+                            }
+                        }
+                        catch (const std::system_error&)
+                        {
+                            // fewer workers, the calling thread processes the rest of chunks
+                        }
+                    }
+
+                    void work()
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        for (;;)
+                        {
+                            m_job_ready.wait(lock, [&] {
+                                return m_job != nullptr && m_job->workers < m_max_workers &&
+                                       m_job->has_chunks();
+                            });
+                            auto job = m_job;
+                            job->workers++;
+                            lock.unlock();
+                            job->run_chunks();
+                            lock.lock();
+                            if (--job->workers == 0)
+                            {
+                                m_job_done.notify_all();
+                            }
+                        }
+                    }
+
+                    std::mutex m_mutex;
+                    std::condition_variable m_job_ready;
+                    std::condition_variable m_job_done;
+                    Job* m_job = nullptr;
+                    size_t m_max_workers = 0;
+                };
+            }
+
+            size_t get_parallel_threads()
+            {
+                static const size_t threads = []() -> size_t {
+                    const int32_t env_threads = getenv_int("NGRAPH_REFERENCE_THREADS", 0);
+                    return env_threads > 0 ? static_cast<size_t>(env_threads) : available_cpus();
+                }();
+                return threads;
+            }
+
+            void parallel_for(size_t work_amount,
+                              size_t grain_size,
+                              const std::function<void(size_t, size_t)>& func)
+            {
+                if (work_amount == 0)
+                {
+                    return;
+                }
+                const size_t max_chunks = work_amount / std::max<size_t>(grain_size, 1);
+                size_t chunks = std::min(get_parallel_threads(), max_chunks);
+                if (chunks >= 2 && !in_parallel_region)
+                {
+                    chunks = std::min(chunks, available_cpus());
+                }
+                if (chunks < 2 || in_parallel_region)
+                {
+                    func(0, work_amount);
+                    return;
+                }
+
+                Job job(func, work_amount, chunks);
+                if (!WorkerPool::get().run(job, chunks - 1))
+                {
+                    // the pool is busy with a call from another thread
+                    func(0, work_amount);
+                    return;
+                }
+                for (const auto& error : job.errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -32,6 +32,7 @@ descriptor::Input::Input(Node* node, size_t index, Output& output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
     output.add_input(this);
+    m_node->invalidate_ordered_ops();
 }
 
 descriptor::Input::Input(Node* node, size_t index)
@@ -41,11 +42,16 @@ descriptor::Input::Input(Node* node, size_t index)
     , m_is_relevant_to_shape(false)
     , m_is_relevant_to_value(true)
 {
+    m_node->invalidate_ordered_ops();
 }
 
 descriptor::Input::~Input()
 {
-    remove_output();
+    // inputs are destroyed with their node or as copies, neither is ordered in a function
+    if (m_output != nullptr)
+    {
+        m_output->remove_input(this);
+    }
 }
 
 void descriptor::Input::replace_output(Output& new_output)
@@ -57,6 +63,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    invalidate_ordered_ops();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -79,6 +86,16 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        invalidate_ordered_ops();
+    }
+}
+
+void descriptor::Input::invalidate_ordered_ops()
+{
+    // copies of inputs are not connected to the node
+    if (m_index < m_node->m_inputs.size() && &m_node->m_inputs[m_index] == this)
+    {
+        m_node->invalidate_ordered_ops();
     }
 }
 
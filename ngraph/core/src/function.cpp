@@ -124,6 +124,20 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    auto& cache = m_ordered_ops_cache;
+    lock_guard<mutex> lock(cache.mutex);
+    auto version = cache.version->load(memory_order_acquire);
+    if (cache.valid && cache.ops_version == version)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(cache.ops.size());
+        for (auto node : cache.ops)
+        {
+            ordered_ops.push_back(node->shared_from_this());
+        }
+        return ordered_ops;
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -138,7 +152,21 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    Node::register_ordered_ops_version(ordered_ops, cache.version);
+    cache.ops.clear();
+    for (auto& node : ordered_ops)
+    {
+        cache.ops.push_back(node.get());
+    }
+    cache.ops_version = version;
+    cache.valid = true;
+    return ordered_ops;
+}
+
+void Function::invalidate_ordered_ops()
+{
+    m_ordered_ops_cache.version->fetch_add(1, memory_order_release);
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -302,11 +330,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -376,12 +406,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_ordered_ops();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -390,11 +422,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -404,6 +438,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_ordered_ops();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
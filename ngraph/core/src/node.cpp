@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -64,6 +66,7 @@ Node& Node::operator=(const Node& node)
     this->m_provenance_tags = node.m_provenance_tags;
     this->m_provenance_group = node.m_provenance_group;
     this->m_inputs = node.m_inputs;
+    invalidate_ordered_ops();
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
     // cannot do it without copying node.m_inputs first due to too limiting const qualifiers
@@ -208,6 +211,49 @@ descriptor::Input& Node::get_input_descriptor(size_t position)
     return m_inputs.at(position);
 }
 
+namespace
+{
+    // Nodes may be shared by functions ordered in different threads
+    mutex& ordered_ops_versions_mutex()
+    {
+        static mutex versions_mutex;
+        return versions_mutex;
+    }
+}
+
+void Node::invalidate_ordered_ops()
+{
+    lock_guard<mutex> lock(ordered_ops_versions_mutex());
+    for (auto& weak_version : m_ordered_ops_versions)
+    {
+        if (auto version = weak_version.lock())
+        {
+            version->fetch_add(1, memory_order_release);
+        }
+    }
+}
+
+void Node::register_ordered_ops_version(const std::vector<std::shared_ptr<Node>>& nodes,
+                                        const std::shared_ptr<std::atomic<size_t>>& version)
+{
+    lock_guard<mutex> lock(ordered_ops_versions_mutex());
+    for (auto& node : nodes)
+    {
+        auto& versions = node->m_ordered_ops_versions;
+        versions.erase(remove_if(versions.begin(),
+                                 versions.end(),
+                                 [](const weak_ptr<atomic<size_t>>& v) { return v.expired(); }),
+                       versions.end());
+        auto it = find_if(versions.begin(), versions.end(), [&](const weak_ptr<atomic<size_t>>& v) {
+            return !v.owner_before(version) && !version.owner_before(v);
+        });
+        if (it == versions.end())
+        {
+            versions.emplace_back(version);
+        }
+    }
+}
+
 descriptor::Output& Node::get_output_descriptor(size_t position)
 {
     while (m_outputs.size() <= position)
@@ -476,6 +522,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        invalidate_ordered_ops();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -513,6 +560,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_ordered_ops();
         }
     }
     {
@@ -535,6 +583,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_ordered_ops();
 }
 
 void Node::clear_control_dependents()
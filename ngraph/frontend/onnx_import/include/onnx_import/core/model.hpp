@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -41,6 +42,9 @@ namespace ngraph
         public:
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \brief Creates a model which shares the ownership of the proto with the
+            ///        constants made of its initializers.
+            explicit Model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto);
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -51,6 +55,11 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            /// \return The proto if the model shares its ownership, nullptr otherwise.
+            const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& get_shared_model_proto() const
+            {
+                return m_shared_model_proto;
+            }
             const OpsetImports& get_opset_imports() const;
             const std::string& get_producer_version() const
             {
@@ -84,6 +93,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_shared_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
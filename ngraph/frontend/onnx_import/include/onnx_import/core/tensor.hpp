@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -172,9 +174,12 @@ namespace ngraph
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
                         {
                             const auto tensor_external_data = TensorExternalData(tensor);
-                            const auto raw_data = tensor_external_data.load_external_data();
+                            const auto data = tensor_external_data.map_external_data();
+                            const auto it = data->get_ptr<const T>();
 
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            return std::vector<T>(
+                                it,
+                                it + (data->size() / __get_onnx_data_size(tensor.data_type())));
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -483,8 +488,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor       The tensor proto.
+            /// \param model_proto  The model the tensor proto belongs to. If it is given,
+            ///                     constants share the raw data with the model instead of
+            ///                     copying it, and keep the model alive.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -606,8 +617,41 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                const auto byte_size = shape_size(m_shape) * sizeof(T);
+                if (m_tensor_proto->has_segment() || byte_size == 0)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
+                else if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    auto data = detail::TensorExternalData(*m_tensor_proto).map_external_data();
+                    constant = data->size() == byte_size && is_aligned<T>(data->get_ptr())
+                                   ? std::make_shared<ngraph::op::Constant>(type, m_shape, data)
+                                   : std::make_shared<ngraph::op::Constant>(
+                                         type, m_shape, get_data<T>());
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == byte_size)
+                {
+                    const auto& raw_data = m_tensor_proto->raw_data();
+                    if (m_model_proto && is_aligned<T>(raw_data.data()))
+                    {
+                        std::shared_ptr<void> owner = m_model_proto;
+                        auto data = std::make_shared<detail::SharedData>(
+                            const_cast<char*>(raw_data.data()), raw_data.size(), owner);
+                        constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+                    }
+                    else
+                    {
+                        constant =
+                            std::make_shared<ngraph::op::Constant>(type, m_shape, raw_data.data());
+                    }
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -615,7 +659,14 @@ namespace ngraph
                 return constant;
             }
 
+            template <typename T>
+            static bool is_aligned(const void* data)
+            {
+                return reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
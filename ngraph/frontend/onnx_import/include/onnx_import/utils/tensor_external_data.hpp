@@ -16,28 +16,34 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
     {
         namespace detail
         {
+            /// \brief  Buffer over memory owned by another object, which it keeps alive
+            using SharedData = runtime::SharedBuffer<std::shared_ptr<void>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
             public:
                 TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
-                /// \brief      Load external data from tensor passed to constructor
+                /// \brief      Map external data from tensor passed to constructor into memory
                 ///
-                /// \note       If read data from external file fails,
-                /// \note       If reading data from external files fails,
-                ///             the invalid_external_data exception is thrown.
+                /// \note       The pages are read from the file on the first access and stay
+                ///             shared with it until they are modified. If the file cannot be
+                ///             mapped, the invalid_external_data exception is thrown.
                 ///
-                /// \return     External binary data loaded into a std::string
-                std::string load_external_data() const;
+                /// \return     Buffer backed by the mapping, unmapped when the buffer is destroyed
+                std::shared_ptr<SharedData> map_external_data() const;
 
                 /// \brief      Represets parameter of external data as string
                 ///
@@ -75,10 +75,12 @@ namespace ngraph
             } // namespace error
 
             std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+                convert_to_ng_function(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
             {
+                // the initializers become constants over the model proto storage,
+                // so it lives as long as any of them
                 Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                Graph graph{model_proto->graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -103,9 +105,9 @@ namespace ngraph
                 }
             }
 
-            ONNX_NAMESPACE::ModelProto model_proto;
+            auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
             // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            if (!model_proto->ParseFromIstream(&stream))
             {
 #ifdef NGRAPH_USE_PROTOBUF_LITE
                 throw detail::error::stream_parse_binary();
@@ -115,16 +117,16 @@ namespace ngraph
                 stream.seekg(0);
                 google::protobuf::io::IstreamInputStream iistream(&stream);
                 // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
                 {
                     throw detail::error::stream_parse_text();
                 }
 #endif
             }
 
-            transform::expand_onnx_functions(model_proto);
-            transform::fixup_legacy_operators(model_proto);
-            transform::update_external_data_paths(model_proto, model_path);
+            transform::expand_onnx_functions(*model_proto);
+            transform::fixup_legacy_operators(*model_proto);
+            transform::update_external_data_paths(*model_proto, model_path);
 
             return detail::convert_to_ng_function(model_proto);
         }
@@ -14,9 +14,20 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <fstream>
 #include <sstream>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "onnx_import/exceptions.hpp"
@@ -28,6 +39,135 @@ namespace ngraph
     {
         namespace detail
         {
+            namespace
+            {
+                /// \brief  Copy-on-write mapping of a part of a file
+                class MappedMemory
+                {
+                public:
+                    MappedMemory(void* view, size_t offset, size_t length)
+                        : m_view{view}
+                        , m_data{static_cast<char*>(view) + offset}
+                        , m_length{offset + length}
+                    {
+                    }
+
+                    ~MappedMemory()
+                    {
+#ifdef _WIN32
+                        UnmapViewOfFile(m_view);
+#else
+                        munmap(m_view, m_length);
+#endif
+                    }
+
+                    MappedMemory(const MappedMemory&) = delete;
+                    MappedMemory& operator=(const MappedMemory&) = delete;
+
+                    char* data() const { return m_data; }
+
+                private:
+                    void* m_view;
+                    char* m_data;
+                    size_t m_length;
+                };
+
+                /// \brief  Maps `length` bytes of the file starting from `offset`, the whole rest
+                ///         of the file if `length` is 0, returns nullptr on failure
+                std::shared_ptr<MappedMemory>
+                    map_file(const std::string& location, size_t offset, size_t& length)
+                {
+#ifdef _WIN32
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+                    const std::wstring path =
+                        file_util::multi_byte_char_to_wstring(location.c_str());
+                    HANDLE file = CreateFileW(path.c_str(),
+#else
+                    HANDLE file = CreateFileA(location.c_str(),
+#endif
+                                              GENERIC_READ,
+                                              FILE_SHARE_READ,
+                                              nullptr,
+                                              OPEN_EXISTING,
+                                              FILE_ATTRIBUTE_NORMAL,
+                                              nullptr);
+                    if (file == INVALID_HANDLE_VALUE)
+                        return nullptr;
+
+                    LARGE_INTEGER file_size;
+                    if (!GetFileSizeEx(file, &file_size) ||
+                        static_cast<size_t>(file_size.QuadPart) < offset)
+                    {
+                        CloseHandle(file);
+                        return nullptr;
+                    }
+                    const auto size = static_cast<size_t>(file_size.QuadPart);
+                    if (length == 0)
+                        length = size - offset;
+                    if (length == 0 || size - offset < length)
+                    {
+                        CloseHandle(file);
+                        return nullptr;
+                    }
+
+                    HANDLE mapping =
+                        CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                    // the view holds its own references to the mapping and the file
+                    CloseHandle(file);
+                    if (mapping == nullptr)
+                        return nullptr;
+
+                    SYSTEM_INFO system_info;
+                    GetSystemInfo(&system_info);
+                    const size_t view_offset =
+                        offset - offset % system_info.dwAllocationGranularity;
+                    const auto view_offset64 = static_cast<unsigned long long>(view_offset);
+                    void* view = MapViewOfFile(mapping,
+                                               FILE_MAP_COPY,
+                                               static_cast<DWORD>(view_offset64 >> 32),
+                                               static_cast<DWORD>(view_offset64 & 0xFFFFFFFF),
+                                               offset - view_offset + length);
+                    CloseHandle(mapping);
+                    if (view == nullptr)
+                        return nullptr;
+#else
+                    int fd = open(location.c_str(), O_RDONLY);
+                    if (fd == -1)
+                        return nullptr;
+
+                    struct stat sb = {};
+                    if (fstat(fd, &sb) == -1 || static_cast<size_t>(sb.st_size) < offset)
+                    {
+                        close(fd);
+                        return nullptr;
+                    }
+                    const auto size = static_cast<size_t>(sb.st_size);
+                    if (length == 0)
+                        length = size - offset;
+                    if (length == 0 || size - offset < length)
+                    {
+                        close(fd);
+                        return nullptr;
+                    }
+
+                    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                    const size_t view_offset = offset - offset % page_size;
+                    // MAP_PRIVATE with write access keeps the pages shared until they are modified
+                    void* view = mmap(nullptr,
+                                      offset - view_offset + length,
+                                      PROT_READ | PROT_WRITE,
+                                      MAP_PRIVATE,
+                                      fd,
+                                      static_cast<off_t>(view_offset));
+                    // the mapping holds its own reference to the file
+                    close(fd);
+                    if (view == MAP_FAILED)
+                        return nullptr;
+#endif
+                    return std::make_shared<MappedMemory>(view, offset - view_offset, length);
+                }
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -43,45 +183,20 @@ namespace ngraph
                 }
             }
 
-            std::string TensorExternalData::load_external_data() const
+            std::shared_ptr<SharedData> TensorExternalData::map_external_data() const
             {
-#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
-#else
-                std::string path = m_data_location;
-#endif
-                std::ifstream external_data_stream(path,
-                                                   std::ios::binary | std::ios::in | std::ios::ate);
-                if (external_data_stream.fail())
-                    throw error::invalid_external_data{*this};
-
-                std::streamsize read_data_lenght;
-                if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
-                else
-                    read_data_lenght = m_data_lenght;
-
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
-                // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
-
                 if (m_sha1_digest != 0)
                 {
                     NGRAPH_WARN << "SHA1 checksum is not supported";
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_lenght);
-                external_data_stream.read(&read_data[0], read_data_lenght);
-                external_data_stream.close();
+                size_t length = m_data_lenght;
+                const auto memory = map_file(m_data_location, m_offset, length);
+                if (!memory)
+                    throw error::invalid_external_data{*this};
 
-                return read_data;
+                std::shared_ptr<void> owner = memory;
+                return std::make_shared<SharedData>(memory->data(), length, owner);
             }
 
             std::string TensorExternalData::to_string() const
@@ -363,3 +363,71 @@ TEST(build_graph, build_graph_with_remove_result)
     nodes = f->get_ops();
     EXPECT_EQ(nodes.size(), 5);
 }
+
+TEST(build_graph, ordered_ops_are_updated_after_graph_modification)
+{
+    auto arg = make_shared<op::Parameter>(element::Type_t::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, (NodeVector{arg, relu, res}));
+    EXPECT_EQ(ops, f->get_ordered_ops());
+
+    auto abs = make_shared<op::Abs>(arg);
+    replace_node(relu, abs);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, abs, res}));
+
+    auto neg = make_shared<op::Negative>(arg);
+    res->input(0).replace_source_output(neg);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, neg, res}));
+
+    neg->add_control_dependency(abs);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, abs, neg, res}));
+    neg->remove_control_dependency(abs);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, neg, res}));
+
+    auto res2 = make_shared<op::Result>(abs);
+    f->add_results({res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+    f->remove_result(res2);
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(build_graph, ordered_ops_do_not_keep_removed_nodes_alive)
+{
+    auto arg = make_shared<op::Parameter>(element::Type_t::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, res}));
+
+    weak_ptr<Node> removed = relu;
+    auto abs = make_shared<op::Abs>(arg);
+    replace_node(relu, abs);
+    relu.reset();
+    EXPECT_TRUE(removed.expired());
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, abs, res}));
+}
+
+TEST(build_graph, ordered_ops_of_functions_sharing_nodes_are_updated)
+{
+    auto arg = make_shared<op::Parameter>(element::Type_t::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res1 = make_shared<op::Result>(relu);
+    auto res2 = make_shared<op::Result>(relu);
+    auto f1 = make_shared<Function>(ResultVector{res1}, ParameterVector{arg});
+    auto f2 = make_shared<Function>(ResultVector{res2}, ParameterVector{arg});
+    EXPECT_EQ(f1->get_ordered_ops(), (NodeVector{arg, relu, res1}));
+    EXPECT_EQ(f2->get_ordered_ops(), (NodeVector{arg, relu, res2}));
+
+    auto neg = make_shared<op::Negative>(arg);
+    relu->input(0).replace_source_output(neg);
+    EXPECT_EQ(f1->get_ordered_ops(), (NodeVector{arg, neg, relu, res1}));
+    EXPECT_EQ(f2->get_ordered_ops(), (NodeVector{arg, neg, relu, res2}));
+
+    f1->add_results({make_shared<op::Result>(arg)});
+    EXPECT_EQ(f1->get_ordered_ops().size(), 5);
+    EXPECT_EQ(f2->get_ordered_ops(), (NodeVector{arg, neg, relu, res2}));
+}
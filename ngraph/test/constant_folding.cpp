@@ -14,11 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -3125,3 +3128,73 @@ TEST(constant_folding, disable_constant_folding)
     ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(f), 1);
     ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
 }
+
+namespace
+{
+    // weights subgraph of a quantized convolution: dequantization and transposition of I8 data
+    shared_ptr<Node> make_int8_weights_subgraph(const Shape& shape)
+    {
+        const size_t channels = shape[0];
+        vector<int8_t> weights(shape_size(shape));
+        for (size_t i = 0; i < weights.size(); i++)
+        {
+            weights[i] = static_cast<int8_t>(static_cast<int>(i * 7 % 255) - 127);
+        }
+        vector<float> zero_points(channels), scales(channels);
+        for (size_t c = 0; c < channels; c++)
+        {
+            zero_points[c] = static_cast<float>(c % 5);
+            scales[c] = 0.01f * (c % 7 + 1);
+        }
+        Shape channel_shape(shape.size(), 1);
+        channel_shape[0] = channels;
+
+        auto data = make_shared<op::Constant>(element::Type_t::i8, shape, weights);
+        auto convert = make_shared<op::Convert>(data, element::Type_t::f32);
+        auto subtract = make_shared<op::v1::Subtract>(
+            convert, op::Constant::create(element::Type_t::f32, channel_shape, zero_points));
+        auto multiply = make_shared<op::v1::Multiply>(
+            subtract, op::Constant::create(element::Type_t::f32, channel_shape, scales));
+        vector<int64_t> order(shape.size());
+        iota(order.begin(), order.end(), 0);
+        swap(order[0], order[1]);
+        return make_shared<op::Transpose>(
+            multiply, op::Constant::create(element::Type_t::i64, Shape{order.size()}, order));
+    }
+}
+
+TEST(constant_folding, large_int8_weights_subgraph)
+{
+    const Shape shape{128, 160, 3, 3};
+    const size_t spatial = shape[2] * shape[3];
+    auto weights = make_int8_weights_subgraph(shape);
+    auto reduce = make_shared<op::v1::ReduceSum>(
+        weights, op::Constant::create(element::Type_t::i64, Shape{2}, {2, 3}));
+    auto f = make_shared<Function>(OutputVector{weights, reduce}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+
+    vector<float> expected_weights(shape_size(shape));
+    vector<float> expected_sums(shape[0] * shape[1], 0);
+    for (size_t c = 0; c < shape[0]; c++)
+    {
+        for (size_t k = 0; k < shape[1]; k++)
+        {
+            for (size_t i = 0; i < spatial; i++)
+            {
+                const size_t index = (c * shape[1] + k) * spatial + i;
+                const float weight = static_cast<int>(index * 7 % 255) - 127;
+                const float value = (weight - static_cast<float>(c % 5)) * (0.01f * (c % 7 + 1));
+                expected_weights[(k * shape[0] + c) * spatial + i] = value;
+                expected_sums[k * shape[0] + c] += value;
+            }
+        }
+    }
+    EXPECT_EQ(expected_weights, get_result_constant<float>(f, 0));
+    // the reference ReduceSum uses Kahan summation and some sums cancel out to zero
+    EXPECT_TRUE(test::all_close(expected_sums, get_result_constant<float>(f, 1), 1e-5f, 1e-5f));
+}
@@ -101,6 +101,19 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_unaligned_offsets)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_unaligned_offsets.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {2, 1}, second: {2, 3} mapped from the middle of the pages of external file
+    test_case.add_input<int32_t>({1, 5});
+
+    test_case.add_expected_output<int32_t>({2, 5});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try